@@ -0,0 +1,539 @@
+/*
+ * XXH64-PRNG
+ * Blazing fast XXH64-based secure pseudo-random number generator
+ *
+ * Copyright (c) 2025 "dEajL3kA" <Cumpoing79@web.de>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * https://www.opensource.org/licenses/bsd-license.php
+ */
+
+#if defined(__linux__) && (!defined(_GNU_SOURCE))
+#  define _GNU_SOURCE 1 /* required for sched_setaffinity() */
+#endif
+
+#include <xxh64_prng.h>
+
+#include "xxh64.h"
+#include "xxh64_prng_core.h"
+#include "xxh64_simd.h"
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+
+#ifdef _WIN32
+#  define WIN32_LEAN_AND_MEAN 1
+#  include <Windows.h>
+#  define POPEN _popen
+#  define PCLOSE _pclose
+#  define STRICMP _stricmp
+#else
+#  include <time.h>
+#  include <unistd.h>
+#  define POPEN popen
+#  define PCLOSE pclose
+#  define STRICMP strcasecmp
+#endif
+
+#ifdef __linux__
+#  include <sched.h>
+#endif
+
+/* minimum duration of each benchmark, in nanoseconds */
+#define BENCH_MIN_TIME UINT64_C(500000000)
+
+/* warm-up duration of each benchmark, in nanoseconds */
+#define BENCH_WARMUP_TIME UINT64_C(50000000)
+
+/* minimum duration of one sample; fast functions are called repeatedly per sample */
+#define BENCH_SAMPLE_TIME UINT64_C(2000)
+
+/* maximum number of samples kept for the latency percentiles */
+#define BENCH_MAX_SAMPLES 65536U
+
+/* buffer size of the "fill" benchmark */
+#define BENCH_FILL_BYTES (64U * 1024U)
+
+/* number of states per xxh64prng_seed_batch() call */
+#define BENCH_SEED_BATCH 64U
+
+/* amount of data read from the command-line tool */
+#define BENCH_CLI_BYTES (UINT64_C(256) << 20)
+#define BENCH_CLI_BUFSIZE (1U << 20)
+
+/* ======================================================================== */
+/* Timing                                                                   */
+/* ======================================================================== */
+
+static uint64_t time_ns(void)
+{
+#ifdef _WIN32
+    static LARGE_INTEGER frequency = { 0 };
+    LARGE_INTEGER counter;
+    if (!frequency.QuadPart) {
+        QueryPerformanceFrequency(&frequency);
+    }
+    QueryPerformanceCounter(&counter);
+    return (uint64_t)((((double)counter.QuadPart) * 1.0e9) / ((double)frequency.QuadPart));
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (((uint64_t)ts.tv_sec) * UINT64_C(1000000000)) + ((uint64_t)ts.tv_nsec);
+#endif
+}
+
+/* Reference cycles (TSC), if available; otherwise zero */
+static uint64_t time_cycles(void)
+{
+#if XXH_SIMD_X86
+    return (uint64_t)__rdtsc();
+#else
+    return 0U;
+#endif
+}
+
+/* Pin the calling thread to the given CPU, to reduce noise from migrations */
+static bool pin_thread(const unsigned cpu)
+{
+#if defined(_WIN32)
+    return (cpu < 64U) && (SetThreadAffinityMask(GetCurrentThread(), ((DWORD_PTR)1U) << cpu) != 0U);
+#elif defined(__linux__)
+    cpu_set_t set;
+    if (cpu >= CPU_SETSIZE) {
+        return false;
+    }
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    return (sched_setaffinity(0, sizeof(cpu_set_t), &set) == 0);
+#else
+    (void)cpu;
+    return false;
+#endif
+}
+
+/* ======================================================================== */
+/* Benchmark functions                                                      */
+/* ======================================================================== */
+
+typedef struct bench_ctx {
+    xxh64prng_t state;
+    xxh64prng_t states[BENCH_SEED_BATCH];
+    xxh64prng_stream_t stream;
+    xxh64prng_x4_t x4;
+    xxh64prng_x8_t x8;
+    uint64_t input[_XXH64PRNG_STATE_WORDS];
+    uint64_t temp[_XXH64PRNG_TEMP_WORDS];
+    uint64_t out[8U * XXH64PRNG_OUTPUT_WORDS];
+    uint8_t *buffer;
+    uint64_t counter;
+    volatile uint64_t sink;
+} bench_ctx_t;
+
+typedef struct bench_def {
+    const char *name;
+    void (*func)(bench_ctx_t *const ctx);
+    size_t bytes;      /* bytes processed (or produced) per call */
+    bool impl_specific;
+} bench_def_t;
+
+static void bench_xxh64(bench_ctx_t *const ctx)
+{
+    ctx->sink ^= XXH64(ctx->input, sizeof(ctx->input), ctx->counter++);
+}
+
+static void bench_step(bench_ctx_t *const ctx)
+{
+    xxh64prng_core_advance(&ctx->state, ctx->temp);
+}
+
+static void bench_expand(bench_ctx_t *const ctx)
+{
+    xxh64prng_core_expand(ctx->temp, ctx->out);
+}
+
+static void bench_next(bench_ctx_t *const ctx)
+{
+    xxh64prng_next(&ctx->state, ctx->out);
+}
+
+static void bench_next_32b(bench_ctx_t *const ctx)
+{
+    xxh64prng_next_partial(&ctx->state, ctx->out, 4U);
+}
+
+static void bench_next_x4(bench_ctx_t *const ctx)
+{
+    xxh64prng_next_x4(&ctx->x4, ctx->out);
+}
+
+static void bench_next_x8(bench_ctx_t *const ctx)
+{
+    xxh64prng_next_x8(&ctx->x8, ctx->out);
+}
+
+static void bench_fill(bench_ctx_t *const ctx)
+{
+    xxh64prng_fill(&ctx->stream, ctx->buffer, BENCH_FILL_BYTES);
+}
+
+static void bench_init(bench_ctx_t *const ctx)
+{
+    xxh64prng_init(&ctx->state, ctx->counter++);
+}
+
+static void bench_seed(bench_ctx_t *const ctx)
+{
+    if (!xxh64prng_seed(&ctx->state)) {
+        abort();
+    }
+}
+
+static void bench_seed_batch(bench_ctx_t *const ctx)
+{
+    if (!xxh64prng_seed_batch(ctx->states, BENCH_SEED_BATCH)) {
+        abort();
+    }
+}
+
+static const bench_def_t BENCHMARKS[] = {
+    { "xxh64_64b", bench_xxh64, _XXH64PRNG_STATE_BYTES,  false },
+    { "init",      bench_init,  0U,                      false },
+    { "seed",      bench_seed,  0U,                      false },
+    { "seed_x64",  bench_seed_batch, 0U,                 false },
+    { "step",      bench_step,  _XXH64PRNG_STATE_BYTES,  true  },
+    { "expand",    bench_expand, XXH64PRNG_OUTPUT_BYTES, true  },
+    { "next",      bench_next,  XXH64PRNG_OUTPUT_BYTES,  true  },
+    { "next_32b",  bench_next_32b, 4U * sizeof(uint64_t), true },
+    { "next_x4",   bench_next_x4, 4U * XXH64PRNG_OUTPUT_BYTES, true },
+    { "next_x8",   bench_next_x8, 8U * XXH64PRNG_OUTPUT_BYTES, true },
+    { "fill",      bench_fill,  BENCH_FILL_BYTES,        true  },
+    { NULL, NULL, 0U, false }
+};
+
+/* ======================================================================== */
+/* Measurement                                                              */
+/* ======================================================================== */
+
+typedef struct bench_result {
+    const char *name;
+    const char *impl;
+    size_t bytes;
+    uint64_t calls;
+    double ns_per_call;
+    double gb_per_sec;      /* zero, if not applicable */
+    double cycles_per_byte; /* zero, if not applicable */
+    double p50_ns, p99_ns;  /* negative, if not applicable */
+} bench_result_t;
+
+static int compare_double(const void *const a, const void *const b)
+{
+    const double x = *((const double*)a), y = *((const double*)b);
+    return (x < y) ? (-1) : ((x > y) ? 1 : 0);
+}
+
+static void run_calls(const bench_def_t *const bench, bench_ctx_t *const ctx, const uint64_t count)
+{
+    uint64_t pos;
+    for (pos = 0U; pos < count; ++pos) {
+        bench->func(ctx);
+    }
+}
+
+static void finish_result(bench_result_t *const result, const uint64_t elapsed_ns, const uint64_t elapsed_cycles, const uint64_t total_bytes)
+{
+    result->ns_per_call = result->calls ? (((double)elapsed_ns) / ((double)result->calls)) : 0.0;
+    result->gb_per_sec = (total_bytes && elapsed_ns) ? (((double)total_bytes) / ((double)elapsed_ns)) : 0.0;
+    result->cycles_per_byte = (total_bytes && elapsed_cycles) ? (((double)elapsed_cycles) / ((double)total_bytes)) : 0.0;
+}
+
+static void measure(const bench_def_t *const bench, bench_ctx_t *const ctx, double *const samples, const uint64_t min_time, bench_result_t *const result)
+{
+    uint64_t calls_per_sample = 1U, start, elapsed = 0U, elapsed_cycles = 0U;
+    size_t count = 0U;
+
+    /* warm-up and calibration */
+    start = time_ns();
+    while (time_ns() - start < BENCH_WARMUP_TIME) {
+        const uint64_t sample_start = time_ns();
+        run_calls(bench, ctx, calls_per_sample);
+        if ((time_ns() - sample_start < BENCH_SAMPLE_TIME) && (calls_per_sample < (UINT64_C(1) << 20))) {
+            calls_per_sample *= 2U;
+        }
+    }
+
+    result->name = bench->name;
+    result->bytes = bench->bytes;
+    result->calls = 0U;
+
+    while ((elapsed < min_time) || (count < 100U)) {
+        const uint64_t sample_start = time_ns(), sample_cycles = time_cycles();
+        uint64_t sample_time;
+        run_calls(bench, ctx, calls_per_sample);
+        sample_time = time_ns() - sample_start;
+        elapsed_cycles += time_cycles() - sample_cycles;
+        elapsed += sample_time;
+        result->calls += calls_per_sample;
+        if (count < BENCH_MAX_SAMPLES) {
+            samples[count++] = ((double)sample_time) / ((double)calls_per_sample);
+        }
+    }
+
+    qsort(samples, count, sizeof(double), compare_double);
+    result->p50_ns = samples[(count * 50U) / 100U];
+    result->p99_ns = samples[(count * 99U) / 100U];
+
+    finish_result(result, elapsed, elapsed_cycles, result->calls * bench->bytes);
+}
+
+/* Read BENCH_CLI_BYTES from the command-line tool, through a pipe */
+static bool measure_cli(const char *const exe_path, const char *const impl, uint8_t *const buffer, bench_result_t *const result)
+{
+    char command[1024U];
+    FILE *pipe;
+    uint64_t total = 0U, start, start_cycles;
+    size_t len;
+
+    if (snprintf(command, sizeof(command), "\"%s\" --impl %s --wipe %s 42 %llu", exe_path, impl, xxh64prng_wipe_name(xxh64prng_get_wipe()), (unsigned long long)BENCH_CLI_BYTES) >= (int)sizeof(command)) {
+        return false;
+    }
+
+    start = time_ns();
+    start_cycles = time_cycles();
+
+#ifdef _WIN32
+    if (!(pipe = POPEN(command, "rb"))) {
+#else
+    if (!(pipe = POPEN(command, "r"))) {
+#endif
+        return false;
+    }
+
+    while ((len = fread(buffer, 1U, BENCH_CLI_BUFSIZE, pipe)) > 0U) {
+        total += len;
+    }
+
+    if ((PCLOSE(pipe) != 0) || (total != BENCH_CLI_BYTES)) {
+        return false;
+    }
+
+    result->name = "cli_pipe";
+    result->bytes = BENCH_CLI_BYTES;
+    result->calls = 1U;
+    result->p50_ns = result->p99_ns = -1.0;
+    finish_result(result, time_ns() - start, time_cycles() - start_cycles, total);
+    return true;
+}
+
+/* ======================================================================== */
+/* Output                                                                   */
+/* ======================================================================== */
+
+static void print_result(const bench_result_t *const result)
+{
+    printf("%-10s %-7s %14.2f ns/call", result->name, result->impl, result->ns_per_call);
+    if (result->gb_per_sec > 0.0) {
+        printf(" %8.3f GB/s", result->gb_per_sec);
+    }
+    if (result->cycles_per_byte > 0.0) {
+        printf(" %8.3f cpb", result->cycles_per_byte);
+    }
+    if (result->p50_ns >= 0.0) {
+        printf("   p50=%.2f ns p99=%.2f ns", result->p50_ns, result->p99_ns);
+    }
+    putchar('\n');
+    fflush(stdout);
+}
+
+static void json_number(FILE *const stream, const char *const key, const double value, const bool valid)
+{
+    if (valid) {
+        fprintf(stream, ", \"%s\": %.6g", key, value);
+    }
+    else {
+        fprintf(stream, ", \"%s\": null", key);
+    }
+}
+
+static bool write_json(const char *const path, const bench_result_t *const results, const size_t count, const int cpu)
+{
+    FILE *stream;
+    size_t index;
+
+    if (!(stream = fopen(path, "w"))) {
+        return false;
+    }
+
+    fprintf(stream, "{\n  \"version\": \"%u.%u.%u\",\n  \"arch\": \"%s\",\n  \"date\": \"%s\",\n  \"cpu\": %d,\n  \"results\": [\n",
+        XXH64PRNG_VERSION_MAJOR, XXH64PRNG_VERSION_MINOR, XXH64PRNG_VERSION_PATCH, XXH64PRNG_ARCH, XXH64PRNG_DATE, cpu);
+
+    for (index = 0U; index < count; ++index) {
+        const bench_result_t *const result = results + index;
+        fprintf(stream, "    { \"name\": \"%s\", \"impl\": \"%s\", \"bytes_per_call\": %llu, \"calls\": %llu",
+            result->name, result->impl, (unsigned long long)result->bytes, (unsigned long long)result->calls);
+        json_number(stream, "ns_per_call", result->ns_per_call, true);
+        json_number(stream, "gb_per_sec", result->gb_per_sec, result->gb_per_sec > 0.0);
+        json_number(stream, "cycles_per_byte", result->cycles_per_byte, result->cycles_per_byte > 0.0);
+        json_number(stream, "p50_ns", result->p50_ns, result->p50_ns >= 0.0);
+        json_number(stream, "p99_ns", result->p99_ns, result->p99_ns >= 0.0);
+        fprintf(stream, " }%s\n", ((index + 1U) < count) ? "," : "");
+    }
+
+    fputs("  ]\n}\n", stream);
+    return (fclose(stream) == 0);
+}
+
+/* ======================================================================== */
+/* MAIN                                                                     */
+/* ======================================================================== */
+
+#define MAX_RESULTS 64U
+
+static void print_helpscreen(void)
+{
+    puts("Usage:");
+    puts("  xxh_bench [--impl NAME] [--wipe MODE] [--cpu N] [--time MS] [--cli EXE] [--json FILE]\n");
+    puts("Options:");
+    puts("  --impl NAME  Benchmark only the given implementation. Default is all supported ones.");
+    puts("  --wipe MODE  Wiping of temporaries: paranoid (default), destroy or off.");
+    puts("  --cpu N      Pin the benchmark to CPU N. Default is 0; set to -1 to disable.");
+    puts("  --time MS    Minimum duration of each benchmark, in milliseconds. Default is 500.");
+    puts("  --cli EXE    Also benchmark the command-line tool EXE, reading its output through a pipe.");
+    puts("  --json FILE  Write the results to FILE in JSON format.");
+}
+
+int main(int argc, char *argv[])
+{
+    static bench_result_t results[MAX_RESULTS];
+    static double samples[BENCH_MAX_SAMPLES];
+    const char *cli_path = NULL, *json_path = NULL;
+    char version_str[32U];
+    bench_ctx_t ctx;
+    xxh64prng_impl_t impl, only_impl = XXH64PRNG_IMPL_AUTO;
+    uint64_t min_time = BENCH_MIN_TIME;
+    size_t count = 0U;
+    int index, cpu = 0, exit_code = EXIT_FAILURE;
+    const bench_def_t *bench;
+
+    for (index = 1; index < argc; ++index) {
+        if ((!strcmp(argv[index], "--impl")) && (index + 1 < argc)) {
+            const char *name;
+            const char *const arg = argv[++index];
+            for (impl = XXH64PRNG_IMPL_SCALAR; (name = xxh64prng_impl_name(impl)) != NULL; ++impl) {
+                if (!STRICMP(arg, name)) {
+                    break;
+                }
+            }
+            if ((!name) || (!xxh64prng_set_impl(only_impl = impl))) {
+                fprintf(stderr, "Error: Implementation \"%s\" is not supported!\n", arg);
+                return EXIT_FAILURE;
+            }
+        }
+        else if ((!strcmp(argv[index], "--wipe")) && (index + 1 < argc)) {
+            const char *name;
+            xxh64prng_wipe_t policy;
+            const char *const arg = argv[++index];
+            for (policy = XXH64PRNG_WIPE_PARANOID; (name = xxh64prng_wipe_name(policy)) != NULL; ++policy) {
+                if (!STRICMP(arg, name)) {
+                    break;
+                }
+            }
+            if ((!name) || (!xxh64prng_set_wipe(policy))) {
+                fprintf(stderr, "Error: Wiping mode \"%s\" is not supported!\n", arg);
+                return EXIT_FAILURE;
+            }
+        }
+        else if ((!strcmp(argv[index], "--cpu")) && (index + 1 < argc)) {
+            cpu = atoi(argv[++index]);
+        }
+        else if ((!strcmp(argv[index], "--time")) && (index + 1 < argc)) {
+            min_time = strtoull(argv[++index], NULL, 10) * UINT64_C(1000000);
+        }
+        else if ((!strcmp(argv[index], "--cli")) && (index + 1 < argc)) {
+            cli_path = argv[++index];
+        }
+        else if ((!strcmp(argv[index], "--json")) && (index + 1 < argc)) {
+            json_path = argv[++index];
+        }
+        else {
+            print_helpscreen();
+            return (!strcmp(argv[index], "--help")) ? EXIT_SUCCESS : EXIT_FAILURE;
+        }
+    }
+
+    memset(&ctx, 0, sizeof(bench_ctx_t));
+    if (!(ctx.buffer = (uint8_t*)malloc(BENCH_CLI_BUFSIZE))) {
+        fputs("Error: Memory allocation has failed!\n", stderr);
+        return EXIT_FAILURE;
+    }
+
+    if ((cpu >= 0) && (!pin_thread((unsigned)cpu))) {
+        fprintf(stderr, "Warning: Failed to pin the benchmark to CPU %d!\n", cpu);
+        cpu = -1;
+    }
+
+    if (snprintf(version_str, sizeof(version_str), XXH64PRNG_VERSION_PATCH ? "%u.%u-%u" : "%u.%u", XXH64PRNG_VERSION_MAJOR, XXH64PRNG_VERSION_MINOR, XXH64PRNG_VERSION_PATCH) > 0) {
+        printf("XXH64-PRNG v%s [%s] benchmark, CPU %d, wipe %s\n\n", version_str, XXH64PRNG_ARCH, cpu, xxh64prng_wipe_name(xxh64prng_get_wipe()));
+    }
+
+    for (impl = XXH64PRNG_IMPL_SCALAR; xxh64prng_impl_name(impl) != NULL; ++impl) {
+        if (((only_impl != XXH64PRNG_IMPL_AUTO) && (impl != only_impl)) || (!xxh64prng_set_impl(impl))) {
+            continue;
+        }
+        for (bench = BENCHMARKS; bench->name; ++bench) {
+            if ((!bench->impl_specific) && (impl != XXH64PRNG_IMPL_SCALAR) && (only_impl == XXH64PRNG_IMPL_AUTO)) {
+                continue; /* measure only once */
+            }
+            xxh64prng_init(&ctx.state, UINT64_C(42));
+            xxh64prng_stream_init(&ctx.stream, &ctx.state);
+            xxh64prng_derive_batch(ctx.states, 8U, &ctx.state, 0U);
+            xxh64prng_x4_load(&ctx.x4, ctx.states);
+            xxh64prng_x8_load(&ctx.x8, ctx.states);
+            measure(bench, &ctx, samples, min_time, &results[count]);
+            results[count].impl = bench->impl_specific ? xxh64prng_impl_name(impl) : "-";
+            print_result(&results[count++]);
+        }
+        if (cli_path) {
+            results[count].impl = xxh64prng_impl_name(impl);
+            if (!measure_cli(cli_path, xxh64prng_impl_name(impl), ctx.buffer, &results[count])) {
+                fprintf(stderr, "Error: Failed to run the command-line tool \"%s\"!\n", cli_path);
+                goto clean_up;
+            }
+            print_result(&results[count++]);
+        }
+    }
+
+    if (json_path) {
+        if (!write_json(json_path, results, count, cpu)) {
+            fprintf(stderr, "Error: Failed to write the JSON file \"%s\"!\n", json_path);
+            goto clean_up;
+        }
+        printf("\nResults have been written to \"%s\".\n", json_path);
+    }
+
+    exit_code = EXIT_SUCCESS;
+
+clean_up:
+
+    free(ctx.buffer);
+    return exit_code;
+}
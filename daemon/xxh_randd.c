@@ -0,0 +1,577 @@
+/*
+ * XXH64-PRNG
+ * Blazing fast XXH64-based secure pseudo-random number generator
+ *
+ * Copyright (c) 2025 "dEajL3kA" <Cumpoing79@web.de>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * https://www.opensource.org/licenses/bsd-license.php
+ */
+
+#include <xxh64_prng.h>
+#include <xxh_randd.h>
+
+#include "os_support.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <signal.h>
+#include <time.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+#define DEFAULT_SLOTS 64U
+#define MAX_SLOTS 4096U
+#define MAX_CONNECTIONS 256U
+
+/* maximum number of bytes that a socket client may have requested, but not yet received */
+#define MAX_PENDING (UINT64_C(1) << 30)
+
+/* size of the per-connection output buffer */
+#define CONN_BUFSIZE (64U << 10)
+
+/* maximum time to sleep, so that the stop signal and terminated clients are noticed */
+#define SLEEP_TIMEOUT_MS 100
+#define LIVENESS_INTERVAL 1.0
+
+typedef struct connection {
+    int fd;
+    bool eof;
+    xxh64prng_stream_t stream;
+    uint64_t pending;
+    char line[24U];
+    size_t line_len, out_pos, out_len;
+    uint8_t *out;
+} connection_t;
+
+typedef struct server {
+    xxh64prng_t master;
+    uint64_t next_id; /* shared by both threads */
+    xxh_randd_shm_t *shm;
+    size_t shm_size;
+    xxh64prng_t *slot_states; /* private memory, never shared with the clients! */
+    int listen_fd;
+    connection_t conns[MAX_CONNECTIONS];
+    size_t conn_count;
+} server_t;
+
+static volatile sig_atomic_t stop_signal = 0;
+
+static void signal_handler(const int sig)
+{
+    stop_signal = sig;
+}
+
+static bool parse_uint64(const char* const str, uint64_t* const value)
+{
+    char* endptr = NULL;
+    errno = 0;
+    *value = strtoull(str, &endptr, 0);
+    if (errno || (endptr == str) || (*endptr)) {
+        return false;
+    }
+    return true;
+}
+
+/* Derive the state of the next client from the master state; every client gets a different ID */
+static void next_stream(server_t *const server, xxh64prng_t *const state, uint64_t *const id)
+{
+    *id = __atomic_fetch_add(&server->next_id, 1U, __ATOMIC_RELAXED);
+    xxh64prng_derive(state, &server->master, *id);
+}
+
+/* ======================================================================== */
+/* Shared-memory rings                                                      */
+/* ======================================================================== */
+
+/* Check whether an existing segment is owned by a daemon that is still running */
+static bool shm_in_use(const char *const name)
+{
+    const size_t size = sizeof(xxh_randd_shm_t);
+    const xxh_randd_shm_t *header;
+    bool in_use = false;
+    void *addr;
+
+    const int fd = shm_open(name, O_RDONLY, 0);
+    if (fd < 0) {
+        return false;
+    }
+
+    if ((addr = mmap(NULL, size, PROT_READ, MAP_SHARED, fd, 0)) != MAP_FAILED) {
+        header = (const xxh_randd_shm_t*)addr;
+        in_use = (header->magic == XXH_RANDD_MAGIC) && (header->daemon_pid > 0) && (kill(header->daemon_pid, 0) == 0);
+        munmap(addr, size);
+    }
+
+    close(fd);
+    return in_use;
+}
+
+static bool shm_create(server_t *const server, const char *const name, const uint32_t slot_count)
+{
+    int fd;
+    void *addr;
+
+    server->shm_size = XXH_RANDD_SHM_SIZE(slot_count);
+
+    if ((fd = shm_open(name, O_RDWR | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR)) < 0) {
+        if (errno != EEXIST) {
+            return false;
+        }
+        if (shm_in_use(name)) {
+            fputs("Error: Another instance of the daemon is already running!\n", stderr);
+            return false;
+        }
+        shm_unlink(name); /* stale segment, left over by a daemon that has crashed */
+        if ((fd = shm_open(name, O_RDWR | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR)) < 0) {
+            return false;
+        }
+    }
+
+    if ((ftruncate(fd, (off_t)server->shm_size) != 0) || ((addr = mmap(NULL, server->shm_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0)) == MAP_FAILED)) {
+        close(fd);
+        shm_unlink(name);
+        return false;
+    }
+
+    close(fd);
+    server->shm = (xxh_randd_shm_t*)addr;
+
+    if (sem_init(&server->shm->wakeup.sem, 1, 0U) != 0) {
+        munmap(addr, server->shm_size);
+        server->shm = NULL;
+        shm_unlink(name);
+        return false;
+    }
+
+    server->shm->version = XXH_RANDD_VERSION;
+    server->shm->slot_count = slot_count;
+    server->shm->daemon_pid = (int32_t)getpid();
+    __atomic_store_n(&server->shm->magic, XXH_RANDD_MAGIC, __ATOMIC_RELEASE); /* clients check this last */
+
+    return true;
+}
+
+/* Top up the ring of a slot, returns the number of blocks that have been generated */
+static size_t shm_refill(xxh_randd_slot_t *const slot, xxh64prng_t *const state)
+{
+    const uint64_t tail = __atomic_load_n(&slot->tail, __ATOMIC_SEQ_CST);
+    uint64_t head = slot->head;
+    size_t count = 0U;
+
+    while ((head - tail) < XXH_RANDD_RING_BLOCKS) {
+        xxh64prng_next(state, (uint64_t*)slot->blocks[head % XXH_RANDD_RING_BLOCKS]);
+        __atomic_store_n(&slot->head, ++head, __ATOMIC_RELEASE);
+        ++count;
+    }
+
+    return count;
+}
+
+/* Prepare fresh streams for the empty slots and refill the rings of the attached clients, returns the number of blocks that have been generated */
+static size_t shm_serve(server_t *const server, const bool check_owners)
+{
+    size_t index, count = 0U;
+
+    for (index = 0U; index < server->shm->slot_count; ++index) {
+        xxh_randd_slot_t *const slot = xxh_randd_slot(server->shm, (uint32_t)index);
+        uint64_t *const slot_state = xxh_randd_state(server->shm, (uint32_t)index);
+        uint64_t state = __atomic_load_n(slot_state, __ATOMIC_SEQ_CST);
+
+        switch (XXH_RANDD_STATE_VALUE(state)) {
+        case XXH_RANDD_SLOT_EMPTY:
+            next_stream(server, &server->slot_states[index], &slot->stream_id);
+            slot->head = slot->tail = 0U;
+            count += shm_refill(slot, &server->slot_states[index]);
+            __atomic_store_n(slot_state, XXH_RANDD_SLOT_AVAILABLE, __ATOMIC_RELEASE); /* only the daemon leaves this state */
+            break;
+        case XXH_RANDD_SLOT_ATTACHED:
+            if (check_owners && (kill(XXH_RANDD_STATE_OWNER(state), 0) != 0) && (errno == ESRCH)) {
+                __atomic_compare_exchange_n(slot_state, &state, XXH_RANDD_SLOT_EMPTY, false, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED);
+                break; /* the client has terminated without detaching */
+            }
+            count += shm_refill(slot, &server->slot_states[index]);
+            break;
+        default:
+            break;
+        }
+    }
+
+    return count;
+}
+
+/*
+ * Sleep until a client wakes us up (see xxh_randd_wake()). The flag is published *before* the slots are checked
+ * once more, so either that check sees the client's update, or the client sees the flag and posts the semaphore.
+ */
+static void shm_sleep(server_t *const server, const bool check_owners)
+{
+    struct timespec deadline;
+
+    __atomic_store_n(&server->shm->sleeping, 1U, __ATOMIC_SEQ_CST);
+
+    if (shm_serve(server, check_owners) == 0U) {
+        clock_gettime(CLOCK_REALTIME, &deadline);
+        deadline.tv_nsec += SLEEP_TIMEOUT_MS * 1000000L;
+        if (deadline.tv_nsec >= 1000000000L) {
+            deadline.tv_nsec -= 1000000000L;
+            ++deadline.tv_sec;
+        }
+        sem_timedwait(&server->shm->wakeup.sem, &deadline);
+    }
+
+    __atomic_store_n(&server->shm->sleeping, 0U, __ATOMIC_SEQ_CST);
+}
+
+/* ======================================================================== */
+/* Socket protocol                                                          */
+/* ======================================================================== */
+
+/*
+ * Each connection has its own stream. The client sends the number of bytes that it wants, as a decimal number
+ * terminated by a newline, and the daemon responds with exactly that many bytes. Requests may be pipelined.
+ */
+
+static bool socket_create(server_t *const server, const char *const path)
+{
+    struct sockaddr_un addr;
+    int probe;
+
+    if (strlen(path) >= sizeof(addr.sun_path)) {
+        return false;
+    }
+
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strcpy(addr.sun_path, path);
+
+    if ((probe = socket(AF_UNIX, SOCK_STREAM, 0)) >= 0) {
+        const bool in_use = (connect(probe, (const struct sockaddr*)&addr, sizeof(addr)) == 0);
+        close(probe);
+        if (in_use) {
+            fputs("Error: Another instance of the daemon is already running!\n", stderr);
+            return false;
+        }
+        unlink(path); /* stale socket */
+    }
+
+    if ((server->listen_fd = socket(AF_UNIX, SOCK_STREAM, 0)) < 0) {
+        return false;
+    }
+
+    if ((bind(server->listen_fd, (const struct sockaddr*)&addr, sizeof(addr)) != 0) || (listen(server->listen_fd, SOMAXCONN) != 0) || (fcntl(server->listen_fd, F_SETFL, O_NONBLOCK) != 0)) {
+        close(server->listen_fd);
+        server->listen_fd = -1;
+        return false;
+    }
+
+    return true;
+}
+
+static void conn_accept(server_t *const server)
+{
+    connection_t *conn;
+    xxh64prng_t state;
+    uint64_t id;
+    int fd;
+
+    while ((fd = accept(server->listen_fd, NULL, NULL)) >= 0) {
+        if ((server->conn_count >= MAX_CONNECTIONS) || (fcntl(fd, F_SETFL, O_NONBLOCK) != 0)) {
+            close(fd);
+            continue;
+        }
+        conn = &server->conns[server->conn_count];
+        memset(conn, 0, sizeof(connection_t));
+        if (!(conn->out = (uint8_t*)malloc(CONN_BUFSIZE))) {
+            close(fd);
+            continue;
+        }
+        conn->fd = fd;
+        next_stream(server, &state, &id);
+        xxh64prng_stream_init(&conn->stream, &state);
+        xxh64prng_zero(&state, sizeof(xxh64prng_t));
+        ++server->conn_count;
+    }
+}
+
+static void conn_close(server_t *const server, const size_t index)
+{
+    connection_t *const conn = &server->conns[index];
+
+    close(conn->fd);
+    xxh64prng_zero(conn->out, CONN_BUFSIZE);
+    free(conn->out);
+    xxh64prng_zero(conn, sizeof(connection_t));
+
+    if (index + 1U < server->conn_count) {
+        memcpy(conn, &server->conns[server->conn_count - 1U], sizeof(connection_t));
+        xxh64prng_zero(&server->conns[server->conn_count - 1U], sizeof(connection_t));
+    }
+
+    --server->conn_count;
+}
+
+/* Parse the requests that have been received, fails on a protocol error */
+static bool conn_read(connection_t *const conn)
+{
+    char buffer[256U];
+    ssize_t len, pos;
+
+    while ((len = read(conn->fd, buffer, sizeof(buffer))) != 0) {
+        if (len < 0) {
+            return (errno == EAGAIN) || (errno == EWOULDBLOCK) || (errno == EINTR);
+        }
+        for (pos = 0; pos < len; ++pos) {
+            uint64_t count;
+            if (buffer[pos] != '\n') {
+                if (conn->line_len >= sizeof(conn->line) - 1U) {
+                    return false;
+                }
+                conn->line[conn->line_len++] = buffer[pos];
+                continue;
+            }
+            conn->line[conn->line_len] = '\0';
+            conn->line_len = 0U;
+            if ((!parse_uint64(conn->line, &count)) || (count > MAX_PENDING - conn->pending)) {
+                return false;
+            }
+            conn->pending += count;
+        }
+    }
+
+    conn->eof = true;
+    return true;
+}
+
+/* Send as much of the requested output as possible without blocking, fails if the connection is broken */
+static bool conn_write(connection_t *const conn)
+{
+    for (;;) {
+        ssize_t result;
+        if (conn->out_pos >= conn->out_len) {
+            if (!conn->pending) {
+                return true;
+            }
+            conn->out_len = (conn->pending < CONN_BUFSIZE) ? ((size_t)conn->pending) : CONN_BUFSIZE;
+            conn->out_pos = 0U;
+            conn->pending -= conn->out_len;
+            xxh64prng_fill(&conn->stream, conn->out, conn->out_len);
+        }
+        if ((result = send(conn->fd, conn->out + conn->out_pos, conn->out_len - conn->out_pos, MSG_NOSIGNAL)) < 0) {
+            return (errno == EAGAIN) || (errno == EWOULDBLOCK) || (errno == EINTR);
+        }
+        conn->out_pos += (size_t)result;
+    }
+}
+
+static bool conn_busy(const connection_t *const conn)
+{
+    return (conn->out_pos < conn->out_len) || (conn->pending > 0U);
+}
+
+/* Wait for socket events (or until the timeout expires), then serve the connections */
+static void socket_serve(server_t *const server, const int timeout)
+{
+    struct pollfd fds[MAX_CONNECTIONS + 1U];
+    size_t index, count = server->conn_count;
+
+    fds[0].fd = server->listen_fd;
+    fds[0].events = POLLIN;
+
+    for (index = 0U; index < count; ++index) {
+        fds[index + 1U].fd = server->conns[index].fd;
+        fds[index + 1U].events = POLLIN | (conn_busy(&server->conns[index]) ? POLLOUT : 0);
+    }
+
+    if (poll(fds, (nfds_t)(count + 1U), timeout) <= 0) {
+        return;
+    }
+
+    /* iterate backwards, as closing a connection moves the last one into its place */
+    for (index = count; index > 0U; --index) {
+        connection_t *const conn = &server->conns[index - 1U];
+        const short revents = fds[index].revents;
+        bool success = true;
+        if (revents & (POLLIN | POLLHUP | POLLERR)) {
+            success = conn_read(conn);
+        }
+        if (success && (revents & (POLLOUT | POLLIN))) {
+            success = conn_write(conn);
+        }
+        if ((!success) || (conn->eof && (!conn_busy(conn)))) {
+            conn_close(server, index - 1U);
+        }
+    }
+
+    if (fds[0].revents & POLLIN) {
+        conn_accept(server);
+    }
+}
+
+/* The socket clients are served by a separate thread, so that the shared-memory loop can sleep on its semaphore */
+static void socket_main(void *const arg)
+{
+    server_t *const server = (server_t*)arg;
+
+    while (!stop_signal) {
+        socket_serve(server, SLEEP_TIMEOUT_MS);
+    }
+}
+
+/* ======================================================================== */
+/* MAIN                                                                     */
+/* ======================================================================== */
+
+static void print_helpscreen(void)
+{
+    puts("xxh_randd - serves XXH64-PRNG streams to local processes\n");
+    puts("Synopsis:");
+    puts("  xxh_randd [OPTIONS]\n");
+    puts("Options:");
+    puts("  --shm NAME     Name of the shared-memory segment. Default is \"" XXH_RANDD_SHM_NAME "\".");
+    puts("  --socket PATH  Path of the Unix-domain socket. Default is \"" XXH_RANDD_SOCKET_PATH "\".");
+    puts("  --slots N      Number of shared-memory clients that can be attached at the same time.");
+    puts("  --seed N       Derive all client streams from SEED, instead of a random seed.");
+    puts("  --help         Print help screen and exit.\n");
+    puts("Every client (shared-memory slot or socket connection) receives its own derived stream.");
+}
+
+int main(int argc, char *argv[])
+{
+    int index = 1, exit_code = EXIT_FAILURE;
+    const char *shm_name = XXH_RANDD_SHM_NAME, *socket_path = XXH_RANDD_SOCKET_PATH;
+    uint64_t slot_count = DEFAULT_SLOTS, seed = 0U;
+    bool is_seeded = false;
+    time_t last_check = 0;
+    xxh64prng_os_thread_t *socket_thread = NULL;
+    static server_t server;
+
+    while (index < argc) {
+        const char *const arg = argv[index++];
+        if ((!strcmp(arg, "--shm")) && (index < argc) && (argv[index][0] == '/')) {
+            shm_name = argv[index++];
+        }
+        else if ((!strcmp(arg, "--socket")) && (index < argc) && argv[index][0]) {
+            socket_path = argv[index++];
+        }
+        else if ((!strcmp(arg, "--slots")) && (index < argc) && parse_uint64(argv[index], &slot_count) && (slot_count > 0U) && (slot_count <= MAX_SLOTS)) {
+            ++index;
+        }
+        else if ((!strcmp(arg, "--seed")) && (index < argc) && parse_uint64(argv[index], &seed)) {
+            is_seeded = true;
+            ++index;
+        }
+        else if ((!strcmp(arg, "--help")) || (!strcmp(arg, "-h"))) {
+            print_helpscreen();
+            return EXIT_SUCCESS;
+        }
+        else {
+            fprintf(stderr, "Error: Option \"%s\" is not supported, or its argument is invalid!\n", arg);
+            return EXIT_FAILURE;
+        }
+    }
+
+    server.listen_fd = -1;
+
+    if (is_seeded) {
+        xxh64prng_init(&server.master, seed);
+    }
+    else if (!xxh64prng_seed(&server.master)) {
+        fputs("Error: Failed to acquire seed data from the system's entropy source!\n", stderr);
+        return EXIT_FAILURE;
+    }
+
+    signal(SIGINT, signal_handler);
+    signal(SIGTERM, signal_handler);
+    signal(SIGPIPE, SIG_IGN);
+    umask(S_IRWXG | S_IRWXO); /* the socket and the segment must only be accessible by the owner */
+
+    if (!(server.slot_states = (xxh64prng_t*)calloc((size_t)slot_count, sizeof(xxh64prng_t)))) {
+        fputs("Error: Memory allocation has failed!\n", stderr);
+        goto clean_up;
+    }
+
+    if (!shm_create(&server, shm_name, (uint32_t)slot_count)) {
+        fprintf(stderr, "Error: Failed to create the shared-memory segment \"%s\"!\n", shm_name);
+        goto clean_up;
+    }
+
+    if (!socket_create(&server, socket_path)) {
+        fprintf(stderr, "Error: Failed to create the socket \"%s\"!\n", socket_path);
+        goto clean_up;
+    }
+
+    fprintf(stderr, "Serving on \"%s\" (shared memory, %u slots) and \"%s\" (socket).\n", shm_name, (unsigned)slot_count, socket_path);
+
+    if (!(socket_thread = xxh64prng_os_thread_create(socket_main, &server))) {
+        fputs("Error: Failed to create the socket thread!\n", stderr);
+        goto clean_up;
+    }
+
+    while (!stop_signal) {
+        const time_t now = time(NULL);
+        const bool check_owners = (difftime(now, last_check) >= LIVENESS_INTERVAL);
+        if (check_owners) {
+            last_check = now;
+        }
+        if (shm_serve(&server, check_owners) == 0U) {
+            shm_sleep(&server, false);
+        }
+    }
+
+    exit_code = EXIT_SUCCESS;
+
+clean_up:
+
+    if (socket_thread) {
+        xxh64prng_os_thread_join(socket_thread);
+    }
+
+    while (server.conn_count > 0U) {
+        conn_close(&server, server.conn_count - 1U);
+    }
+
+    if (server.listen_fd >= 0) {
+        close(server.listen_fd);
+        unlink(socket_path);
+    }
+
+    if (server.shm) {
+        for (index = 0; ((uint32_t)index) < server.shm->slot_count; ++index) {
+            xxh_randd_slot_t *const slot = xxh_randd_slot(server.shm, (uint32_t)index);
+            xxh64prng_zero(slot->blocks, sizeof(slot->blocks)); /* the header is kept, attached clients detect by the PID that the daemon is gone */
+        }
+        munmap(server.shm, server.shm_size);
+        shm_unlink(shm_name);
+    }
+
+    if (server.slot_states) {
+        xxh64prng_zero(server.slot_states, (size_t)slot_count * sizeof(xxh64prng_t));
+        free(server.slot_states);
+    }
+
+    xxh64prng_zero(&server.master, sizeof(xxh64prng_t));
+    return exit_code;
+}
@@ -34,10 +34,34 @@
 #if defined(__cplusplus)
 #  include <cstdlib>
 #  include <cstdint>
+#  include <cstring>
 #else
 #  include <stdlib.h>
 #  include <stdint.h>
 #  include <stdbool.h>
+#  include <string.h>
+#endif
+
+#if defined(__cplusplus) || (defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L))
+#  define _XXH64PRNG_INLINE static inline
+#elif defined(_MSC_VER)
+#  define _XXH64PRNG_INLINE static __inline
+#else
+#  define _XXH64PRNG_INLINE static
+#endif
+
+/*
+ * Header-only mode: if XXH64PRNG_HEADER_ONLY is defined before this header is
+ * included, the whole library is compiled into the including translation unit
+ * and all functions become "static inline", so that the compiler can inline
+ * and specialize them at the call site. Otherwise, link the library.
+ */
+#if defined(XXH64PRNG_HEADER_ONLY)
+#  define XXH64PRNG_API _XXH64PRNG_INLINE
+#  define _XXH64PRNG_DATA static
+#else
+#  define XXH64PRNG_API
+#  define _XXH64PRNG_DATA
 #endif
 
 /* internal state size */
@@ -48,14 +72,86 @@
 #define XXH64PRNG_OUTPUT_WORDS (12 * _XXH64PRNG_STATE_WORDS)
 #define XXH64PRNG_OUTPUT_BYTES ((size_t)(sizeof(uint64_t) * XXH64PRNG_OUTPUT_WORDS))
 
+/* checkpoint format version, size and flags */
+#define XXH64PRNG_CHECKPOINT_VERSION 2U
+#define XXH64PRNG_CHECKPOINT_BYTES 104U
+#define XXH64PRNG_CHECKPOINT_COUNTER 0x1U
+
 typedef struct xxh64prng {
 	uint64_t state[_XXH64PRNG_STATE_WORDS];
 } xxh64prng_t;
 
+typedef struct xxh64prng_stream {
+	xxh64prng_t prng;
+	size_t offset;
+	uint64_t block[XXH64PRNG_OUTPUT_WORDS];
+} xxh64prng_stream_t;
+
+typedef struct xxh64prng_ctr {
+	uint64_t key[_XXH64PRNG_STATE_WORDS];
+	uint64_t counter;
+	size_t offset;
+	uint64_t block[XXH64PRNG_OUTPUT_WORDS];
+} xxh64prng_ctr_t;
+
+/* 4 or 8 independent states, interleaved word by word ("structure of arrays") */
+typedef struct xxh64prng_x4 {
+	uint64_t state[_XXH64PRNG_STATE_WORDS][4U];
+} xxh64prng_x4_t;
+
+typedef struct xxh64prng_x8 {
+	uint64_t state[_XXH64PRNG_STATE_WORDS][8U];
+} xxh64prng_x8_t;
+
+/* worker pool for parallel generation (opaque) */
+typedef struct xxh64prng_mt xxh64prng_mt_t;
+
+/* pool of per-thread generators (opaque) */
+typedef struct xxh64prng_pool xxh64prng_pool_t;
+
+/* per-thread generator of a pool, "block" is the current block (read-only) */
+typedef struct xxh64prng_local {
+	const uint64_t *block;
+	size_t offset;
+} xxh64prng_local_t;
+
+/* XXH64 streaming hash state */
+typedef struct xxh64prng_hash {
+	uint64_t acc[4U];
+	uint64_t seed;
+	uint64_t total_len;
+	uint8_t buffer[32U];
+	size_t buffered;
+} xxh64prng_hash_t;
+
+/* statistics counters, see xxh64prng_set_stats() */
+typedef struct xxh64prng_stats {
+	uint64_t blocks;  /* output blocks computed, including partial blocks */
+	uint64_t steps;   /* iterations of the state chain, including those of skipped blocks */
+	uint64_t retries; /* state iterations whose re-hash loop had to be repeated */
+} xxh64prng_stats_t;
+
+/* output function implementations */
+typedef enum xxh64prng_impl {
+	XXH64PRNG_IMPL_AUTO = 0,
+	XXH64PRNG_IMPL_SCALAR,
+	XXH64PRNG_IMPL_AVX2,
+	XXH64PRNG_IMPL_AVX512,
+	XXH64PRNG_IMPL_NEON
+} xxh64prng_impl_t;
+
+/* memory wiping policies */
+typedef enum xxh64prng_wipe {
+	XXH64PRNG_WIPE_PARANOID = 0,  /* wipe all temporaries immediately after use (default) */
+	XXH64PRNG_WIPE_ON_DESTROY,    /* keep temporaries in locked scratch memory, wiped at thread/process exit */
+	XXH64PRNG_WIPE_OFF            /* never wipe temporaries, for non-secret workloads only! */
+} xxh64prng_wipe_t;
+
 #if defined(__cplusplus)
 extern "C" {
 #endif
 
+#if !defined(XXH64PRNG_HEADER_ONLY)
 /* version number */
 extern const uint16_t XXH64PRNG_VERSION_MAJOR;
 extern const uint16_t XXH64PRNG_VERSION_MINOR;
@@ -64,17 +160,208 @@ extern const uint16_t XXH64PRNG_VERSION_PATCH;
 /* build info */
 extern const char* const XXH64PRNG_DATE;
 extern const char* const XXH64PRNG_ARCH;
+#endif
 
 /* RNG functions */
-void xxh64prng_init(xxh64prng_t *const state, const uint64_t seed);
-bool xxh64prng_seed(xxh64prng_t *const state);
-void xxh64prng_next(xxh64prng_t *const state, uint64_t *const out);
+XXH64PRNG_API void xxh64prng_init(xxh64prng_t *const state, const uint64_t seed);
+XXH64PRNG_API bool xxh64prng_seed(xxh64prng_t *const state);
+XXH64PRNG_API bool xxh64prng_seed_batch(xxh64prng_t *const states, const size_t count);
+XXH64PRNG_API void xxh64prng_derive(xxh64prng_t *const child, const xxh64prng_t *const parent, const uint64_t id);
+XXH64PRNG_API void xxh64prng_derive_batch(xxh64prng_t *const children, const size_t count, const xxh64prng_t *const parent, const uint64_t first_id);
+XXH64PRNG_API void xxh64prng_next(xxh64prng_t *const state, uint64_t *const out);
+XXH64PRNG_API void xxh64prng_next_partial(xxh64prng_t *const state, uint64_t *const out, const size_t count);
+XXH64PRNG_API void xxh64prng_discard(xxh64prng_t *const state, uint64_t nblocks);
+
+/* interleaved functions */
+XXH64PRNG_API void xxh64prng_x4_load(xxh64prng_x4_t *const states, const xxh64prng_t *const src);
+XXH64PRNG_API void xxh64prng_x4_store(const xxh64prng_x4_t *const states, xxh64prng_t *const dst);
+XXH64PRNG_API void xxh64prng_next_x4(xxh64prng_x4_t *const states, uint64_t *const out);
+XXH64PRNG_API void xxh64prng_x8_load(xxh64prng_x8_t *const states, const xxh64prng_t *const src);
+XXH64PRNG_API void xxh64prng_x8_store(const xxh64prng_x8_t *const states, xxh64prng_t *const dst);
+XXH64PRNG_API void xxh64prng_next_x8(xxh64prng_x8_t *const states, uint64_t *const out);
+
+/* bulk functions */
+XXH64PRNG_API void xxh64prng_stream_init(xxh64prng_stream_t *const stream, const xxh64prng_t *const state);
+XXH64PRNG_API void xxh64prng_fill(xxh64prng_stream_t *const stream, void *const buf, size_t len);
+XXH64PRNG_API void xxh64prng_fill_final(xxh64prng_stream_t *const stream, void *const buf, const size_t len);
+XXH64PRNG_API void xxh64prng_skip(xxh64prng_stream_t *const stream, uint64_t len);
+
+/* counter mode functions */
+XXH64PRNG_API void xxh64prng_ctr_init(xxh64prng_ctr_t *const ctr, const xxh64prng_t *const key);
+XXH64PRNG_API void xxh64prng_ctr_seek(xxh64prng_ctr_t *const ctr, const uint64_t offset);
+XXH64PRNG_API void xxh64prng_ctr_block(const xxh64prng_ctr_t *const ctr, const uint64_t index, void *const out);
+XXH64PRNG_API void xxh64prng_ctr_fill(xxh64prng_ctr_t *const ctr, void *const buf, size_t len);
+XXH64PRNG_API void xxh64prng_ctr_fill_final(xxh64prng_ctr_t *const ctr, void *const buf, const size_t len);
+
+/* checkpoint functions */
+XXH64PRNG_API void xxh64prng_checkpoint_encode(uint8_t *const out, const xxh64prng_t *const state, const uint64_t offset, const uint64_t origin, const uint32_t flags);
+XXH64PRNG_API bool xxh64prng_checkpoint_decode(const uint8_t *const data, xxh64prng_t *const state, uint64_t *const offset, uint64_t *const origin, uint32_t *const flags);
+XXH64PRNG_API void xxh64prng_stream_resume(xxh64prng_stream_t *const stream, const xxh64prng_t *const state, const uint64_t offset);
+
+/* parallel bulk functions */
+XXH64PRNG_API xxh64prng_mt_t *xxh64prng_mt_create(size_t threads);
+XXH64PRNG_API void xxh64prng_mt_fill(xxh64prng_mt_t *const mt, xxh64prng_stream_t *const stream, void *const buf, size_t len);
+XXH64PRNG_API void xxh64prng_mt_ctr_fill(xxh64prng_mt_t *const mt, xxh64prng_ctr_t *const ctr, void *const buf, size_t len);
+XXH64PRNG_API void xxh64prng_mt_destroy(xxh64prng_mt_t *const mt);
+
+/* per-thread generator pool */
+XXH64PRNG_API xxh64prng_pool_t *xxh64prng_pool_create(const xxh64prng_t *const master, size_t slots, size_t queue_blocks, const bool refiller);
+XXH64PRNG_API xxh64prng_local_t *xxh64prng_pool_acquire(xxh64prng_pool_t *const pool);
+XXH64PRNG_API void xxh64prng_pool_release(xxh64prng_local_t *const local);
+XXH64PRNG_API void xxh64prng_pool_destroy(xxh64prng_pool_t *const pool);
+XXH64PRNG_API void xxh64prng_local_fill(xxh64prng_local_t *const local, void *const buf, size_t len);
+
+/* distribution functions */
+XXH64PRNG_API void xxh64prng_fill_uniform(xxh64prng_stream_t *const stream, double *const out, const size_t count);
+XXH64PRNG_API void xxh64prng_fill_uniform_f(xxh64prng_stream_t *const stream, float *const out, const size_t count);
+XXH64PRNG_API void xxh64prng_fill_normal(xxh64prng_stream_t *const stream, double *const out, const size_t count);
+XXH64PRNG_API void xxh64prng_fill_exponential(xxh64prng_stream_t *const stream, double *const out, const size_t count);
+
+/* implementation selection (process-wide, must not be called while other threads are generating) */
+XXH64PRNG_API bool xxh64prng_set_impl(const xxh64prng_impl_t impl);
+XXH64PRNG_API xxh64prng_impl_t xxh64prng_get_impl(void);
+XXH64PRNG_API const char *xxh64prng_impl_name(const xxh64prng_impl_t impl);
+
+/* memory wiping policy (process-wide, must not be called while other threads are generating) */
+XXH64PRNG_API bool xxh64prng_set_wipe(const xxh64prng_wipe_t policy);
+XXH64PRNG_API xxh64prng_wipe_t xxh64prng_get_wipe(void);
+XXH64PRNG_API const char *xxh64prng_wipe_name(const xxh64prng_wipe_t policy);
+XXH64PRNG_API void xxh64prng_wipe_scratch(void);
+
+/* XXH64 hash functions */
+XXH64PRNG_API uint64_t xxh64prng_hash(const void *const input, const size_t len, const uint64_t seed);
+XXH64PRNG_API void xxh64prng_hash_init(xxh64prng_hash_t *const hash, const uint64_t seed);
+XXH64PRNG_API void xxh64prng_hash_update(xxh64prng_hash_t *const hash, const void *const input, size_t len);
+XXH64PRNG_API uint64_t xxh64prng_hash_digest(const xxh64prng_hash_t *const hash);
+XXH64PRNG_API void xxh64prng_hash_multi(const void *const *const inputs, const size_t *const lens, const size_t count, const uint64_t seed, uint64_t *const out);
+
+/* statistics (opt-in) */
+XXH64PRNG_API void xxh64prng_set_stats(xxh64prng_stats_t *const stats);
+XXH64PRNG_API bool xxh64prng_get_stats(xxh64prng_stats_t *const out);
 
 /* utility functions */
-void xxh64prng_zero(void *const addr, const size_t len);
+XXH64PRNG_API void xxh64prng_zero(void *const addr, const size_t len);
 
 #if defined(__cplusplus)
 }
 #endif
 
+/* scalar functions (inline) */
+
+_XXH64PRNG_INLINE uint64_t xxh64prng_next_u64(xxh64prng_stream_t *const stream)
+{
+	uint64_t value;
+	if (stream->offset <= (XXH64PRNG_OUTPUT_BYTES - sizeof(uint64_t))) {
+		memcpy(&value, ((const uint8_t*)stream->block) + stream->offset, sizeof(uint64_t));
+		stream->offset += sizeof(uint64_t);
+	}
+	else {
+		xxh64prng_fill(stream, &value, sizeof(uint64_t));
+	}
+	return value;
+}
+
+_XXH64PRNG_INLINE uint32_t xxh64prng_next_u32(xxh64prng_stream_t *const stream)
+{
+	uint32_t value;
+	if (stream->offset <= (XXH64PRNG_OUTPUT_BYTES - sizeof(uint32_t))) {
+		memcpy(&value, ((const uint8_t*)stream->block) + stream->offset, sizeof(uint32_t));
+		stream->offset += sizeof(uint32_t);
+	}
+	else {
+		xxh64prng_fill(stream, &value, sizeof(uint32_t));
+	}
+	return value;
+}
+
+_XXH64PRNG_INLINE void xxh64prng_next_bytes(xxh64prng_stream_t *const stream, void *const buf, const size_t len)
+{
+	if (len <= (XXH64PRNG_OUTPUT_BYTES - stream->offset)) {
+		memcpy(buf, ((const uint8_t*)stream->block) + stream->offset, len);
+		stream->offset += len;
+	}
+	else {
+		xxh64prng_fill(stream, buf, len);
+	}
+}
+
+_XXH64PRNG_INLINE uint64_t xxh64prng_local_next_u64(xxh64prng_local_t *const local)
+{
+	uint64_t value;
+	if (local->offset <= (XXH64PRNG_OUTPUT_BYTES - sizeof(uint64_t))) {
+		memcpy(&value, ((const uint8_t*)local->block) + local->offset, sizeof(uint64_t));
+		local->offset += sizeof(uint64_t);
+	}
+	else {
+		xxh64prng_local_fill(local, &value, sizeof(uint64_t));
+	}
+	return value;
+}
+
+_XXH64PRNG_INLINE uint32_t xxh64prng_local_next_u32(xxh64prng_local_t *const local)
+{
+	uint32_t value;
+	if (local->offset <= (XXH64PRNG_OUTPUT_BYTES - sizeof(uint32_t))) {
+		memcpy(&value, ((const uint8_t*)local->block) + local->offset, sizeof(uint32_t));
+		local->offset += sizeof(uint32_t);
+	}
+	else {
+		xxh64prng_local_fill(local, &value, sizeof(uint32_t));
+	}
+	return value;
+}
+
+/* unbiased random integer in the range [0, bound), using multiply-shift with rejection */
+
+_XXH64PRNG_INLINE uint32_t xxh64prng_next_bounded_u32(xxh64prng_stream_t *const stream, const uint32_t bound)
+{
+	uint64_t product = ((uint64_t)xxh64prng_next_u32(stream)) * bound;
+	if (((uint32_t)product) < bound) {
+		const uint32_t threshold = ((uint32_t)(0U - bound)) % bound;
+		while (((uint32_t)product) < threshold) {
+			product = ((uint64_t)xxh64prng_next_u32(stream)) * bound;
+		}
+	}
+	return (uint32_t)(product >> 32);
+}
+
+_XXH64PRNG_INLINE uint64_t _xxh64prng_mul128(const uint64_t a, const uint64_t b, uint64_t *const lo)
+{
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__SIZEOF_INT128__)
+	const __uint128_t product = ((__uint128_t)a) * b;
+	*lo = (uint64_t)product;
+	return (uint64_t)(product >> 64);
+#else
+	const uint64_t a_lo = a & UINT32_MAX, a_hi = a >> 32, b_lo = b & UINT32_MAX, b_hi = b >> 32;
+	const uint64_t lo_lo = a_lo * b_lo, hi_lo = a_hi * b_lo, lo_hi = a_lo * b_hi;
+	const uint64_t cross = (lo_lo >> 32) + (hi_lo & UINT32_MAX) + lo_hi;
+	*lo = (cross << 32) | (lo_lo & UINT32_MAX);
+	return (a_hi * b_hi) + (hi_lo >> 32) + (cross >> 32);
+#endif
+}
+
+_XXH64PRNG_INLINE uint64_t xxh64prng_next_bounded_u64(xxh64prng_stream_t *const stream, const uint64_t bound)
+{
+	uint64_t lo, hi = _xxh64prng_mul128(xxh64prng_next_u64(stream), bound, &lo);
+	if (lo < bound) {
+		const uint64_t threshold = (0U - bound) % bound;
+		while (lo < threshold) {
+			hi = _xxh64prng_mul128(xxh64prng_next_u64(stream), bound, &lo);
+		}
+	}
+	return hi;
+}
+
+/* implementation (header-only mode) */
+
+#if defined(XXH64PRNG_HEADER_ONLY)
+#  include "../lib/os_support.c"
+#  include "../lib/xxh64.c"
+#  include "../lib/xxh64_simd.c"
+#  include "../lib/xxh64_prng.c"
+#  include "../lib/xxh64_prng_mt.c"
+#  include "../lib/xxh64_prng_pool.c"
+#  include "../lib/xxh64_prng_dist.c"
+#endif
+
 #endif /*_XXH64PRNG_H*/
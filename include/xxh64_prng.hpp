@@ -0,0 +1,272 @@
+/*
+ * XXH64-PRNG
+ * Blazing fast XXH64-based secure pseudo-random number generator
+ *
+ * Copyright (c) 2025 "dEajL3kA" <Cumpoing79@web.de>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * https://www.opensource.org/licenses/bsd-license.php
+ */
+
+#ifndef _XXH64PRNG_HPP
+#define _XXH64PRNG_HPP
+
+#include "xxh64_prng.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <ios>
+#include <istream>
+#include <ostream>
+#include <stdexcept>
+#include <type_traits>
+
+#if defined(__GNUC__) || defined(__clang__)
+#  define _XXH64PRNG_UNLIKELY(X) (__builtin_expect(!!(X), 0))
+#else
+#  define _XXH64PRNG_UNLIKELY(X) (X)
+#endif
+
+namespace xxh64_prng
+{
+	/*
+	 * XXH64-PRNG engine, satisfies the UniformRandomBitGenerator requirements and
+	 * the RandomNumberEngine requirements (except that it is move-only, in order
+	 * to avoid accidental copies of the secret state; use clone() for an explicit
+	 * copy). "Blocks" is the number of output blocks that are buffered.
+	 *
+	 * The engine always holds a non-empty buffer, so that operator() is a plain
+	 * buffer read, followed by a branch that is almost never taken. The values
+	 * are the same as returned by xxh64prng_next_u64()/xxh64prng_next_u32() for
+	 * the same seed, regardless of the number of buffered blocks.
+	 */
+	template<typename UIntType = std::uint64_t, std::size_t Blocks = 1U>
+	class engine
+	{
+		static_assert(std::is_same<UIntType, std::uint32_t>::value || std::is_same<UIntType, std::uint64_t>::value, "result type must be uint32_t or uint64_t");
+		static_assert(Blocks > 0U, "at least one block must be buffered");
+
+	public:
+		typedef UIntType result_type;
+
+		static constexpr std::size_t block_size = XXH64PRNG_OUTPUT_BYTES / sizeof(result_type);
+		static constexpr std::size_t buffer_size = Blocks * block_size;
+		static constexpr result_type default_seed = 0U;
+
+		static constexpr result_type min() { return 0U; }
+		static constexpr result_type max() { return ~result_type(0U); }
+
+		/* construction */
+
+		engine() { seed(default_seed); }
+
+		explicit engine(const result_type value) { seed(value); }
+
+		template<typename Sseq, typename = typename std::enable_if<!std::is_convertible<Sseq, result_type>::value && !std::is_same<typename std::decay<Sseq>::type, engine>::value>::type>
+		explicit engine(Sseq &seq) { seed(seq); }
+
+		engine(engine &&other) noexcept
+		{
+			take(other);
+		}
+
+		engine &operator=(engine &&other) noexcept
+		{
+			if (this != &other) {
+				take(other);
+			}
+			return *this;
+		}
+
+		engine(const engine&) = delete;
+		engine &operator=(const engine&) = delete;
+
+		~engine()
+		{
+			xxh64prng_zero(m_buffer, sizeof(m_buffer));
+			xxh64prng_zero(&m_state, sizeof(xxh64prng_t));
+			xxh64prng_zero(&m_origin, sizeof(xxh64prng_t));
+		}
+
+		/* Create engine from the system's secure source of entropy */
+		static engine from_entropy()
+		{
+			engine result((uninitialized_t()));
+			result.seed_from_entropy();
+			return result;
+		}
+
+		/* Create an explicit copy, including the secret state */
+		engine clone() const
+		{
+			engine result((uninitialized_t()));
+			result.assign(*this);
+			return result;
+		}
+
+		/* seeding */
+
+		void seed(const result_type value = default_seed)
+		{
+			xxh64prng_init(&m_state, (std::uint64_t)value);
+			refill();
+		}
+
+		template<typename Sseq>
+		typename std::enable_if<!std::is_convertible<Sseq, result_type>::value>::type seed(Sseq &seq)
+		{
+			std::uint32_t words[2U * _XXH64PRNG_STATE_WORDS];
+			seq.generate(words, words + (2U * _XXH64PRNG_STATE_WORDS));
+			for (std::size_t pos = 0U; pos < _XXH64PRNG_STATE_WORDS; ++pos) {
+				m_state.state[pos] = ((std::uint64_t)words[2U * pos]) | (((std::uint64_t)words[(2U * pos) + 1U]) << 32);
+			}
+			xxh64prng_zero(words, sizeof(words));
+			refill();
+		}
+
+		void seed_from_entropy()
+		{
+			if (!xxh64prng_seed(&m_state)) {
+				throw std::runtime_error("xxh64prng: failed to read from the entropy source");
+			}
+			refill();
+		}
+
+		/* generation */
+
+		result_type operator()()
+		{
+			result_type value;
+			std::memcpy(&value, reinterpret_cast<const unsigned char*>(m_buffer) + (m_offset * sizeof(result_type)), sizeof(result_type));
+			if (_XXH64PRNG_UNLIKELY(++m_offset >= buffer_size)) {
+				refill();
+			}
+			return value;
+		}
+
+		void discard(unsigned long long count)
+		{
+			const std::size_t avail = buffer_size - m_offset;
+			if (count < avail) {
+				m_offset += (std::size_t)count;
+				return;
+			}
+			count -= avail;
+			xxh64prng_discard(&m_state, (count / buffer_size) * Blocks); /* skip whole buffers, so that equal positions compare equal */
+			count %= buffer_size;
+			refill();
+			m_offset = (std::size_t)count;
+		}
+
+		/* comparison and serialization */
+
+		friend bool operator==(const engine &lhs, const engine &rhs)
+		{
+			return (lhs.m_offset == rhs.m_offset) && (!std::memcmp(&lhs.m_origin, &rhs.m_origin, sizeof(xxh64prng_t)));
+		}
+
+		friend bool operator!=(const engine &lhs, const engine &rhs)
+		{
+			return !(lhs == rhs);
+		}
+
+		template<typename CharT, typename Traits>
+		friend std::basic_ostream<CharT, Traits> &operator<<(std::basic_ostream<CharT, Traits> &stream, const engine &e)
+		{
+			const std::ios_base::fmtflags flags = stream.flags(std::ios_base::dec | std::ios_base::left);
+			const CharT space = stream.widen(' ');
+			for (std::size_t pos = 0U; pos < _XXH64PRNG_STATE_WORDS; ++pos) {
+				stream << e.m_origin.state[pos] << space;
+			}
+			stream << e.m_offset;
+			stream.flags(flags);
+			return stream;
+		}
+
+		template<typename CharT, typename Traits>
+		friend std::basic_istream<CharT, Traits> &operator>>(std::basic_istream<CharT, Traits> &stream, engine &e)
+		{
+			const std::ios_base::fmtflags flags = stream.flags(std::ios_base::dec | std::ios_base::skipws);
+			xxh64prng_t origin;
+			std::size_t offset = 0U;
+			for (std::size_t pos = 0U; pos < _XXH64PRNG_STATE_WORDS; ++pos) {
+				stream >> origin.state[pos];
+			}
+			stream >> offset;
+			if ((!stream.fail()) && (offset >= buffer_size)) {
+				stream.setstate(std::ios_base::failbit);
+			}
+			if (!stream.fail()) {
+				e.m_state = origin;
+				e.refill();
+				e.m_offset = offset;
+			}
+			xxh64prng_zero(&origin, sizeof(origin));
+			stream.flags(flags);
+			return stream;
+		}
+
+	private:
+		struct uninitialized_t { };
+		explicit engine(uninitialized_t) : m_offset(0U) { }
+
+		/* the buffer holds the output blocks generated from "m_origin", "m_state" is the state after that */
+		std::uint64_t m_buffer[Blocks * XXH64PRNG_OUTPUT_WORDS];
+		xxh64prng_t m_state;
+		xxh64prng_t m_origin;
+		std::size_t m_offset;
+
+		void refill()
+		{
+			m_origin = m_state;
+			for (std::size_t block = 0U; block < Blocks; ++block) {
+				xxh64prng_next(&m_state, m_buffer + (block * XXH64PRNG_OUTPUT_WORDS));
+			}
+			m_offset = 0U;
+		}
+
+		void assign(const engine &other)
+		{
+			std::memcpy(m_buffer, other.m_buffer, sizeof(m_buffer));
+			m_state = other.m_state;
+			m_origin = other.m_origin;
+			m_offset = other.m_offset;
+		}
+
+		void take(engine &other)
+		{
+			assign(other);
+			other.seed(default_seed); /* the moved-from engine must not keep the secret state */
+		}
+	};
+
+	template<typename UIntType, std::size_t Blocks> constexpr std::size_t engine<UIntType, Blocks>::block_size;
+	template<typename UIntType, std::size_t Blocks> constexpr std::size_t engine<UIntType, Blocks>::buffer_size;
+	template<typename UIntType, std::size_t Blocks> constexpr typename engine<UIntType, Blocks>::result_type engine<UIntType, Blocks>::default_seed;
+
+	typedef engine<std::uint64_t> engine64;
+	typedef engine<std::uint32_t> engine32;
+}
+
+#endif /*_XXH64PRNG_HPP*/
@@ -0,0 +1,304 @@
+/*
+ * XXH64-PRNG
+ * Blazing fast XXH64-based secure pseudo-random number generator
+ *
+ * Copyright (c) 2025 "dEajL3kA" <Cumpoing79@web.de>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * https://www.opensource.org/licenses/bsd-license.php
+ */
+
+#ifndef _XXH_RANDD_H
+#define _XXH_RANDD_H
+
+/*
+ * Client for the xxh_randd daemon (POSIX only). The daemon publishes a shared-memory segment with one ring of
+ * pre-generated output blocks per client slot. Every unused slot is assigned a fresh stream, derived from the
+ * daemon's master state with xxh64prng_derive(), ahead of time; a client claims such a slot with a single atomic
+ * operation, and the daemon keeps its ring filled. Each ring has exactly one producer (the daemon) and one
+ * consumer (the client), so no locks are required. When a ring is half empty, the client wakes the daemon, if
+ * it is sleeping.
+ *
+ * All processes that can open the segment can read all rings; run the daemon under the same user as its clients.
+ *
+ * A client belongs to the process that has attached it. After fork(), the child must not use the parent's client:
+ * reading fails, and detaching only unmaps the segment, leaving the parent's slot alone. The child attaches its own
+ * client, if it needs one.
+ */
+
+#include "xxh64_prng.h"
+
+#include <stddef.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <sched.h>
+#include <signal.h>
+#include <semaphore.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+/* default names */
+#define XXH_RANDD_SHM_NAME "/xxh_randd"
+#define XXH_RANDD_SOCKET_PATH "/tmp/xxh_randd.sock"
+
+/* layout version and magic number of the shared-memory segment */
+#define XXH_RANDD_MAGIC UINT64_C(0x4450524E5248584B)
+#define XXH_RANDD_VERSION 1U
+
+/* number of blocks in the ring of each slot */
+#define XXH_RANDD_RING_BLOCKS 64U
+
+/* slot states, the upper bits of the state hold the PID of the owner, so that both are updated atomically */
+#define XXH_RANDD_SLOT_EMPTY 0U     /* waiting for the daemon to assign a fresh stream */
+#define XXH_RANDD_SLOT_AVAILABLE 1U /* fresh stream assigned and ring filled, can be claimed by a client */
+#define XXH_RANDD_SLOT_ATTACHED 2U  /* claimed by a client, the ring is being refilled */
+
+#define XXH_RANDD_STATE(OWNER, STATE) ((((uint64_t)(OWNER)) << 8) | (STATE))
+#define XXH_RANDD_STATE_OWNER(X) ((pid_t)((X) >> 8))
+#define XXH_RANDD_STATE_VALUE(X) ((uint32_t)((X) & 0xFFU))
+
+/* segment header, followed by the table of "slot_count" slot states and then by the slots themselves */
+typedef struct xxh_randd_shm {
+	uint64_t magic;
+	uint32_t version;
+	uint32_t slot_count;
+	int32_t daemon_pid;
+	uint32_t sleeping; /* set while the daemon waits on "wakeup" */
+	uint8_t _pad0[40U];
+	union {
+		sem_t sem;
+		uint8_t _pad1[64U];
+	} wakeup;
+} xxh_randd_shm_t;
+
+/* the fields written by different processes are kept in separate cache lines */
+typedef struct xxh_randd_slot {
+	uint64_t stream_id;
+	uint8_t _pad0[56U];
+	uint64_t head; /* number of blocks produced, written by the daemon */
+	uint8_t _pad1[56U];
+	uint64_t tail; /* number of blocks consumed, written by the client */
+	uint8_t _pad2[56U];
+	uint8_t blocks[XXH_RANDD_RING_BLOCKS][XXH64PRNG_OUTPUT_BYTES];
+} xxh_randd_slot_t;
+
+#define XXH_RANDD_SLOTS_OFFSET(COUNT) (sizeof(xxh_randd_shm_t) + (((((size_t)(COUNT)) * sizeof(uint64_t)) + 63U) & (~((size_t)63U))))
+#define XXH_RANDD_SHM_SIZE(COUNT) (XXH_RANDD_SLOTS_OFFSET(COUNT) + (((size_t)(COUNT)) * sizeof(xxh_randd_slot_t)))
+
+_XXH64PRNG_INLINE uint64_t *xxh_randd_state(xxh_randd_shm_t *const shm, const uint32_t index)
+{
+	return ((uint64_t*)(shm + 1)) + index;
+}
+
+_XXH64PRNG_INLINE xxh_randd_slot_t *xxh_randd_slot(xxh_randd_shm_t *const shm, const uint32_t index)
+{
+	return ((xxh_randd_slot_t*)(((uint8_t*)shm) + XXH_RANDD_SLOTS_OFFSET(shm->slot_count))) + index;
+}
+
+/* Wake the daemon, if it is sleeping; the preceding updates of the slot must be visible to the daemon */
+_XXH64PRNG_INLINE void xxh_randd_wake(xxh_randd_shm_t *const shm)
+{
+	__atomic_thread_fence(__ATOMIC_SEQ_CST);
+	if (__atomic_load_n(&shm->sleeping, __ATOMIC_RELAXED) && __atomic_exchange_n(&shm->sleeping, 0U, __ATOMIC_SEQ_CST)) {
+		sem_post(&shm->wakeup.sem);
+	}
+}
+
+/* client context */
+typedef struct xxh_randd_client {
+	xxh_randd_shm_t *shm;
+	size_t map_size;
+	uint64_t *state;
+	xxh_randd_slot_t *slot;
+	pid_t pid; /* the process that has attached the client */
+	size_t offset;
+	uint8_t block[XXH64PRNG_OUTPUT_BYTES];
+} xxh_randd_client_t;
+
+/* Wait for the daemon; fails, if the daemon is no longer running */
+_XXH64PRNG_INLINE bool xxh_randd_wait(const xxh_randd_client_t *const client, uint32_t *const rounds)
+{
+	static const struct timespec delay = { 0, 50000L };
+	if ((++(*rounds)) < 64U) {
+		sched_yield();
+		return true;
+	}
+	nanosleep(&delay, NULL);
+	if ((!((*rounds) % 4096U)) && (kill(client->shm->daemon_pid, 0) != 0) && (errno == ESRCH)) {
+		return false;
+	}
+	return true;
+}
+
+/*
+ * Attach to the daemon's shared-memory segment and claim a slot; "name" may be NULL for the default name. Fails if
+ * no slot becomes available within about one second.
+ */
+_XXH64PRNG_INLINE bool xxh_randd_attach(xxh_randd_client_t *const client, const char *const name)
+{
+	struct stat info;
+	uint32_t index, rounds = 0U;
+	void *addr;
+
+	const int fd = shm_open(name ? name : XXH_RANDD_SHM_NAME, O_RDWR, 0);
+	memset(client, 0, sizeof(xxh_randd_client_t));
+
+	if (fd < 0) {
+		return false;
+	}
+
+	if ((fstat(fd, &info) != 0) || (((uint64_t)info.st_size) < (uint64_t)XXH_RANDD_SHM_SIZE(1U))) {
+		close(fd);
+		return false;
+	}
+
+	addr = mmap(NULL, (size_t)info.st_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	close(fd);
+	if (addr == MAP_FAILED) {
+		return false;
+	}
+
+	client->shm = (xxh_randd_shm_t*)addr;
+	client->map_size = (size_t)info.st_size;
+	client->pid = getpid();
+	client->offset = XXH64PRNG_OUTPUT_BYTES;
+
+	if ((__atomic_load_n(&client->shm->magic, __ATOMIC_ACQUIRE) != XXH_RANDD_MAGIC) || (client->shm->version != XXH_RANDD_VERSION) || (XXH_RANDD_SHM_SIZE(client->shm->slot_count) > client->map_size)) {
+		munmap(addr, client->map_size);
+		client->shm = NULL;
+		return false;
+	}
+
+	while ((!client->slot) && (rounds < 20000U)) {
+		for (index = 0U; index < client->shm->slot_count; ++index) {
+			uint64_t expected = XXH_RANDD_SLOT_AVAILABLE;
+			if (__atomic_compare_exchange_n(xxh_randd_state(client->shm, index), &expected, XXH_RANDD_STATE(client->pid, XXH_RANDD_SLOT_ATTACHED), false, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED)) {
+				client->state = xxh_randd_state(client->shm, index);
+				client->slot = xxh_randd_slot(client->shm, index);
+				break;
+			}
+		}
+		if ((!client->slot) && (!xxh_randd_wait(client, &rounds))) {
+			break;
+		}
+	}
+
+	if (!client->slot) {
+		munmap(addr, client->map_size);
+		client->shm = NULL;
+		return false;
+	}
+
+	return true;
+}
+
+/* Internal function to take the next block from the ring, the caller has checked the owner of the client */
+_XXH64PRNG_INLINE bool _xxh_randd_next(xxh_randd_client_t *const client, void *const out)
+{
+	xxh_randd_slot_t *const slot = client->slot;
+	const uint64_t tail = slot->tail;
+	uint32_t rounds = 0U;
+	uint64_t head;
+
+	while ((head = __atomic_load_n(&slot->head, __ATOMIC_ACQUIRE)) == tail) {
+		xxh_randd_wake(client->shm);
+		if (!xxh_randd_wait(client, &rounds)) {
+			return false;
+		}
+	}
+
+	memcpy(out, slot->blocks[tail % XXH_RANDD_RING_BLOCKS], XXH64PRNG_OUTPUT_BYTES);
+	__atomic_store_n(&slot->tail, tail + 1U, __ATOMIC_RELEASE);
+
+	if ((head - tail) <= (XXH_RANDD_RING_BLOCKS / 2U)) {
+		xxh_randd_wake(client->shm);
+	}
+
+	return true;
+}
+
+/* Take the next block from the ring; fails in a child process that has inherited the client (see above) */
+_XXH64PRNG_INLINE bool xxh_randd_next(xxh_randd_client_t *const client, void *const out)
+{
+	if ((!client->slot) || (client->pid != getpid())) {
+		return false;
+	}
+	return _xxh_randd_next(client, out);
+}
+
+/*
+ * Fill buffer of arbitrary size with random bytes from the client's stream; fails, if the daemon has terminated, or
+ * if called in a child process that has inherited the client, so that parent and child never share bytes
+ */
+_XXH64PRNG_INLINE bool xxh_randd_read(xxh_randd_client_t *const client, void *const buf, size_t len)
+{
+	uint8_t *out = (uint8_t*)buf;
+
+	if ((!client->slot) || (client->pid != getpid())) {
+		return false;
+	}
+
+	if (client->offset < XXH64PRNG_OUTPUT_BYTES) {
+		const size_t avail = XXH64PRNG_OUTPUT_BYTES - client->offset;
+		const size_t chunk_size = (len < avail) ? len : avail;
+		memcpy(out, client->block + client->offset, chunk_size);
+		client->offset += chunk_size;
+		out += chunk_size;
+		len -= chunk_size;
+	}
+
+	while (len >= XXH64PRNG_OUTPUT_BYTES) {
+		if (!_xxh_randd_next(client, out)) {
+			return false;
+		}
+		out += XXH64PRNG_OUTPUT_BYTES;
+		len -= XXH64PRNG_OUTPUT_BYTES;
+	}
+
+	if (len > 0U) {
+		if (!_xxh_randd_next(client, client->block)) {
+			return false;
+		}
+		memcpy(out, client->block, len);
+		client->offset = len;
+	}
+
+	return true;
+}
+
+/* Release the slot and detach from the shared-memory segment; in a child process, the parent's slot is left alone */
+_XXH64PRNG_INLINE void xxh_randd_detach(xxh_randd_client_t *const client)
+{
+	if (client->shm) {
+		if (client->pid == getpid()) {
+			__atomic_store_n(client->state, XXH_RANDD_SLOT_EMPTY, __ATOMIC_RELEASE);
+			xxh_randd_wake(client->shm);
+		}
+		munmap(client->shm, client->map_size);
+	}
+	xxh64prng_zero(client, sizeof(xxh_randd_client_t));
+}
+
+#endif /*_XXH_RANDD_H*/
@@ -30,45 +30,253 @@
 
 #include <xxh64_prng.h>
 
+#include "os_support.h"
+
 #ifdef _WIN32
 #  define WIN32_LEAN_AND_MEAN 1
 #  include <Windows.h>
 #  include <bcrypt.h>
+#  include <limits.h>
 #else
 #  include <unistd.h>
 #  include <string.h>
 #  include <strings.h>
 #  include <errno.h>
+#  include <pthread.h>
+#  include <sched.h>
+#  include <sys/mman.h>
+#endif
+
+#if defined(__linux__)
+#  include <sys/random.h>
 #endif
 
 #if defined(__APPLE__) && defined(__MACH__)
 #  include <sys/random.h>
 #endif
 
+/* ======================================================================== */
+/* Locked memory                                                            */
+/* ======================================================================== */
+
+/* Allocate memory that is locked into RAM and excluded from core dumps, "size" is rounded up to the page size */
+static void *locked_alloc(size_t *const size)
+{
+    void *addr;
+    size_t page_size;
+#ifdef _WIN32
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    page_size = (size_t)info.dwPageSize;
+#else
+    const long result = sysconf(_SC_PAGESIZE);
+    page_size = (result > 0L) ? ((size_t)result) : 4096U;
+#endif
+
+    *size = ((*size + page_size - 1U) / page_size) * page_size;
+
+#ifdef _WIN32
+    if (!(addr = VirtualAlloc(NULL, *size, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE))) {
+        return NULL;
+    }
+    if (!VirtualLock(addr, *size)) {
+        VirtualFree(addr, 0U, MEM_RELEASE);
+        return NULL;
+    }
+#else
+    if ((addr = mmap(NULL, *size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0)) == MAP_FAILED) {
+        return NULL;
+    }
+    if (mlock(addr, *size) != 0) {
+        munmap(addr, *size);
+        return NULL;
+    }
+#ifdef MADV_DONTDUMP
+    madvise(addr, *size, MADV_DONTDUMP);
+#endif
+#endif
+
+    return addr;
+}
+
+/* Wipe and release locked memory */
+static void locked_free(void *const addr, const size_t size)
+{
+    xxh64prng_zero(addr, size);
+#ifdef _WIN32
+    VirtualUnlock(addr, size);
+    VirtualFree(addr, 0U, MEM_RELEASE);
+#else
+    munlock(addr, size);
+    munmap(addr, size);
+#endif
+}
+
 /* ======================================================================== */
 /* Platfrom-specific functions                                              */
 /* ======================================================================== */
 
-/* Initialize state from the system's secure source of entropy */
-bool xxh64prng_seed(xxh64prng_t *const state)
+/*
+ * Seeding from a small process-wide entropy pool, which is refilled in bulk,
+ * so that creating many generators does not require one system call each.
+ * The pool lives in locked memory and every byte is wiped as soon as it has
+ * been handed out. On fork(), the pool is discarded in the child process: the
+ * pages are marked MADV_WIPEONFORK (where supported), and the pthread_atfork()
+ * handler wipes them as well.
+ */
+#define POOL_HEADER 64U
+#define POOL_BYTES 8192U
+
+typedef struct entropy_pool {
+    size_t avail; /* wiped on fork, so the pool starts out empty in the child */
+} entropy_pool_t;
+
+static entropy_pool_t *pool = NULL;
+static size_t pool_size = 0U;
+static bool pool_failed = false;
+
+#ifdef _WIN32
+static SRWLOCK pool_lock = SRWLOCK_INIT;
+#  define POOL_LOCK() AcquireSRWLockExclusive(&pool_lock)
+#  define POOL_UNLOCK() ReleaseSRWLockExclusive(&pool_lock)
+#else
+static pthread_mutex_t pool_lock = PTHREAD_MUTEX_INITIALIZER;
+#  define POOL_LOCK() pthread_mutex_lock(&pool_lock)
+#  define POOL_UNLOCK() pthread_mutex_unlock(&pool_lock)
+#endif
+
+/* Read "len" bytes from the system's secure source of entropy, with as few system calls as possible */
+static bool os_entropy(uint8_t *buffer, size_t len)
 {
 #ifdef _WIN32
-    BCRYPT_ALG_HANDLE handle = NULL;
-    bool succeeded = false;
-    if (BCRYPT_SUCCESS(BCryptOpenAlgorithmProvider(&handle, BCRYPT_RNG_ALGORITHM, NULL, 0U))) {
-        if (BCRYPT_SUCCESS(BCryptGenRandom(handle, (PUCHAR)state, (ULONG)sizeof(xxh64prng_t), 0U))) {
-            succeeded = true;
+    while (len > 0U) {
+        const ULONG chunk = (len > ((size_t)ULONG_MAX)) ? ULONG_MAX : ((ULONG)len);
+        if (!BCRYPT_SUCCESS(BCryptGenRandom(NULL, (PUCHAR)buffer, chunk, BCRYPT_USE_SYSTEM_PREFERRED_RNG))) {
+            return false;
         }
-        BCryptCloseAlgorithmProvider(handle, 0U);
+        buffer += chunk;
+        len -= chunk;
+    }
+#elif defined(__linux__)
+    while (len > 0U) {
+        const ssize_t result = getrandom(buffer, len, 0U);
+        if (result < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        buffer += result;
+        len -= (size_t)result;
     }
-    return succeeded;
 #else
-    return (getentropy(state, sizeof(xxh64prng_t)) == 0); /* supported on pretty much all Unixes */
+    while (len > 0U) {
+        const size_t chunk = (len > 256U) ? 256U : len; /* maximum length supported by getentropy() */
+        if (getentropy(buffer, chunk) != 0) {
+            return false;
+        }
+        buffer += chunk;
+        len -= chunk;
+    }
+#endif
+    return true;
+}
+
+#ifndef _WIN32
+static void pool_fork_prepare(void)
+{
+    POOL_LOCK();
+}
+
+static void pool_fork_parent(void)
+{
+    POOL_UNLOCK();
+}
+
+static void pool_fork_child(void)
+{
+    if (pool) {
+        xxh64prng_zero(pool, pool_size);
+    }
+    POOL_UNLOCK();
+}
+#endif
+
+static bool pool_create(void)
+{
+    size_t size = POOL_HEADER + POOL_BYTES;
+
+#ifndef _WIN32
+    if (pthread_atfork(pool_fork_prepare, pool_fork_parent, pool_fork_child) != 0) {
+        return false;
+    }
+#endif
+
+    if (!(pool = (entropy_pool_t*)locked_alloc(&size))) {
+        return false;
+    }
+
+#ifdef MADV_WIPEONFORK
+    madvise(pool, size, MADV_WIPEONFORK);
 #endif
+
+    pool->avail = 0U;
+    pool_size = size;
+    return true;
+}
+
+/* Initialize "count" states from the system's secure source of entropy */
+XXH64PRNG_API bool xxh64prng_seed_batch(xxh64prng_t *const states, const size_t count)
+{
+    const size_t len = count * sizeof(xxh64prng_t);
+    uint8_t *data;
+    bool succeeded = true;
+
+    if (count > (SIZE_MAX / sizeof(xxh64prng_t))) {
+        return false;
+    }
+
+    POOL_LOCK();
+
+    if ((!pool) && (!pool_failed)) {
+        pool_failed = !pool_create();
+    }
+
+    if ((!pool) || (len > POOL_BYTES)) {
+        POOL_UNLOCK();
+        return os_entropy((uint8_t*)states, len); /* large requests bypass the pool */
+    }
+
+    data = ((uint8_t*)pool) + POOL_HEADER;
+
+    if (pool->avail < len) {
+        if (!(succeeded = os_entropy(data, POOL_BYTES))) {
+            xxh64prng_zero(data, POOL_BYTES);
+            pool->avail = 0U;
+        }
+        else {
+            pool->avail = POOL_BYTES;
+        }
+    }
+
+    if (succeeded) {
+        pool->avail -= len;
+        memcpy(states, data + pool->avail, len);
+        xxh64prng_zero(data + pool->avail, len);
+    }
+
+    POOL_UNLOCK();
+    return succeeded;
+}
+
+/* Initialize state from the system's secure source of entropy */
+XXH64PRNG_API bool xxh64prng_seed(xxh64prng_t *const state)
+{
+    return xxh64prng_seed_batch(state, 1U);
 }
 
 /* Securely zero-fill memory area */
-void xxh64prng_zero(void *const addr, const size_t len)
+XXH64PRNG_API void xxh64prng_zero(void *const addr, const size_t len)
 {
 #if defined(_WIN32)
     RtlSecureZeroMemory(addr, len);
@@ -87,3 +295,356 @@ void xxh64prng_zero(void *const addr, const size_t len)
     }
 #endif
 }
+
+/* ======================================================================== */
+/* Threading                                                                */
+/* ======================================================================== */
+
+struct xxh64prng_os_thread {
+#ifdef _WIN32
+    HANDLE handle;
+#else
+    pthread_t handle;
+#endif
+    void (*func)(void*);
+    void *arg;
+};
+
+struct xxh64prng_os_monitor {
+#ifdef _WIN32
+    SRWLOCK lock;
+    CONDITION_VARIABLE cond;
+#else
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+#endif
+};
+
+#ifdef _WIN32
+static DWORD WINAPI xxh64prng_os_thread_main(LPVOID param)
+#else
+static void *xxh64prng_os_thread_main(void *param)
+#endif
+{
+    xxh64prng_os_thread_t *const thread = (xxh64prng_os_thread_t*)param;
+    thread->func(thread->arg);
+#ifdef _WIN32
+    return 0U;
+#else
+    return NULL;
+#endif
+}
+
+/* Create a new thread that runs func(arg), returns NULL on failure */
+XXH64PRNG_API xxh64prng_os_thread_t *xxh64prng_os_thread_create(void (*const func)(void*), void *const arg)
+{
+    xxh64prng_os_thread_t *const thread = (xxh64prng_os_thread_t*)malloc(sizeof(xxh64prng_os_thread_t));
+    if (!thread) {
+        return NULL;
+    }
+
+    thread->func = func;
+    thread->arg = arg;
+
+#ifdef _WIN32
+    if (!(thread->handle = CreateThread(NULL, 0U, xxh64prng_os_thread_main, thread, 0U, NULL))) {
+        free(thread);
+        return NULL;
+    }
+#else
+    if (pthread_create(&thread->handle, NULL, xxh64prng_os_thread_main, thread) != 0) {
+        free(thread);
+        return NULL;
+    }
+#endif
+
+    return thread;
+}
+
+/* Wait for the thread to terminate and release its resources */
+XXH64PRNG_API void xxh64prng_os_thread_join(xxh64prng_os_thread_t *const thread)
+{
+#ifdef _WIN32
+    WaitForSingleObject(thread->handle, INFINITE);
+    CloseHandle(thread->handle);
+#else
+    pthread_join(thread->handle, NULL);
+#endif
+    free(thread);
+}
+
+/* Give up the rest of the calling thread's time slice */
+XXH64PRNG_API void xxh64prng_os_thread_yield(void)
+{
+#ifdef _WIN32
+    SwitchToThread();
+#else
+    sched_yield();
+#endif
+}
+
+#ifdef _WIN32
+static BOOL CALLBACK xxh64prng_os_once_main(PINIT_ONCE once, PVOID param, PVOID *context)
+{
+    (void)once;
+    (void)context;
+    (*(void (**)(void))param)();
+    return TRUE;
+}
+#endif
+
+/* Call func() exactly once per flag; concurrent callers wait until it has returned */
+XXH64PRNG_API void xxh64prng_os_once(xxh64prng_os_once_t *const once, void (*const func)(void))
+{
+#ifdef _WIN32
+    void (*callback)(void) = func;
+    InitOnceExecuteOnce((PINIT_ONCE)once, xxh64prng_os_once_main, (PVOID)&callback, NULL);
+#else
+    pthread_once(once, func);
+#endif
+}
+
+/* Create a new monitor, returns NULL on failure */
+XXH64PRNG_API xxh64prng_os_monitor_t *xxh64prng_os_monitor_create(void)
+{
+    xxh64prng_os_monitor_t *const monitor = (xxh64prng_os_monitor_t*)malloc(sizeof(xxh64prng_os_monitor_t));
+    if (!monitor) {
+        return NULL;
+    }
+
+#ifdef _WIN32
+    InitializeSRWLock(&monitor->lock);
+    InitializeConditionVariable(&monitor->cond);
+#else
+    if (pthread_mutex_init(&monitor->lock, NULL) != 0) {
+        free(monitor);
+        return NULL;
+    }
+    if (pthread_cond_init(&monitor->cond, NULL) != 0) {
+        pthread_mutex_destroy(&monitor->lock);
+        free(monitor);
+        return NULL;
+    }
+#endif
+
+    return monitor;
+}
+
+XXH64PRNG_API void xxh64prng_os_monitor_destroy(xxh64prng_os_monitor_t *const monitor)
+{
+#ifndef _WIN32
+    pthread_cond_destroy(&monitor->cond);
+    pthread_mutex_destroy(&monitor->lock);
+#endif
+    free(monitor);
+}
+
+XXH64PRNG_API void xxh64prng_os_monitor_enter(xxh64prng_os_monitor_t *const monitor)
+{
+#ifdef _WIN32
+    AcquireSRWLockExclusive(&monitor->lock);
+#else
+    if (pthread_mutex_lock(&monitor->lock) != 0) {
+        abort();
+    }
+#endif
+}
+
+XXH64PRNG_API void xxh64prng_os_monitor_leave(xxh64prng_os_monitor_t *const monitor)
+{
+#ifdef _WIN32
+    ReleaseSRWLockExclusive(&monitor->lock);
+#else
+    if (pthread_mutex_unlock(&monitor->lock) != 0) {
+        abort();
+    }
+#endif
+}
+
+/* Wait for notification, monitor must be held by the calling thread */
+XXH64PRNG_API void xxh64prng_os_monitor_wait(xxh64prng_os_monitor_t *const monitor)
+{
+#ifdef _WIN32
+    if (!SleepConditionVariableSRW(&monitor->cond, &monitor->lock, INFINITE, 0U)) {
+        abort();
+    }
+#else
+    if (pthread_cond_wait(&monitor->cond, &monitor->lock) != 0) {
+        abort();
+    }
+#endif
+}
+
+/* Wake up *all* threads waiting on the monitor */
+XXH64PRNG_API void xxh64prng_os_monitor_notify(xxh64prng_os_monitor_t *const monitor)
+{
+#ifdef _WIN32
+    WakeAllConditionVariable(&monitor->cond);
+#else
+    pthread_cond_broadcast(&monitor->cond);
+#endif
+}
+
+/* Get the number of online processors */
+XXH64PRNG_API size_t xxh64prng_os_cpu_count(void)
+{
+#ifdef _WIN32
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return (info.dwNumberOfProcessors > 0U) ? ((size_t)info.dwNumberOfProcessors) : 1U;
+#else
+    const long count = sysconf(_SC_NPROCESSORS_ONLN);
+    return (count > 0L) ? ((size_t)count) : 1U;
+#endif
+}
+
+/* ======================================================================== */
+/* Locked scratch memory                                                    */
+/* ======================================================================== */
+
+/*
+ * Every thread gets its own page of scratch memory, which is locked into RAM
+ * (i.e. it is never written to the swap file) and excluded from core dumps.
+ * The scratch memory is *not* wiped after each use. Instead, all pages are
+ * kept in a list, so that they can be wiped at once; a page is also wiped and
+ * released when its thread exits.
+ */
+typedef struct scratch_page {
+    struct scratch_page *prev, *next;
+    size_t size;
+} scratch_page_t;
+
+#define SCRATCH_HEADER 64U
+
+static scratch_page_t *scratch_list = NULL;
+static scratch_page_t scratch_none; /* marks threads where the allocation has failed */
+
+#ifdef _WIN32
+static SRWLOCK scratch_lock = SRWLOCK_INIT;
+static INIT_ONCE scratch_once = INIT_ONCE_STATIC_INIT;
+static DWORD scratch_key = FLS_OUT_OF_INDEXES;
+#  define SCRATCH_LOCK() AcquireSRWLockExclusive(&scratch_lock)
+#  define SCRATCH_UNLOCK() ReleaseSRWLockExclusive(&scratch_lock)
+#else
+static pthread_mutex_t scratch_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_once_t scratch_once = PTHREAD_ONCE_INIT;
+static pthread_key_t scratch_key;
+static bool scratch_key_valid = false;
+#  define SCRATCH_LOCK() pthread_mutex_lock(&scratch_lock)
+#  define SCRATCH_UNLOCK() pthread_mutex_unlock(&scratch_lock)
+#endif
+
+static scratch_page_t *scratch_alloc(void)
+{
+    size_t size = SCRATCH_HEADER + XXH64PRNG_OS_SCRATCH_BYTES;
+    scratch_page_t *const page = (scratch_page_t*)locked_alloc(&size);
+    if (page) {
+        page->prev = page->next = NULL;
+        page->size = size;
+    }
+    return page;
+}
+
+/* Called when a thread exits: unlink, wipe and release its page */
+#ifdef _WIN32
+static VOID WINAPI scratch_thread_exit(PVOID data)
+#else
+static void scratch_thread_exit(void *data)
+#endif
+{
+    scratch_page_t *const page = (scratch_page_t*)data;
+    if ((!page) || (page == &scratch_none)) {
+        return;
+    }
+
+    SCRATCH_LOCK();
+    if (page->prev) {
+        page->prev->next = page->next;
+    }
+    else {
+        scratch_list = page->next;
+    }
+    if (page->next) {
+        page->next->prev = page->prev;
+    }
+    SCRATCH_UNLOCK();
+
+    locked_free(page, page->size);
+}
+
+static void scratch_process_exit(void)
+{
+    xxh64prng_os_scratch_wipe();
+}
+
+#ifdef _WIN32
+static BOOL CALLBACK scratch_init(PINIT_ONCE once, PVOID param, PVOID *context)
+{
+    (void)once; (void)param; (void)context;
+    scratch_key = FlsAlloc(scratch_thread_exit);
+    atexit(scratch_process_exit);
+    return TRUE;
+}
+#else
+static void scratch_init(void)
+{
+    scratch_key_valid = (pthread_key_create(&scratch_key, scratch_thread_exit) == 0);
+    atexit(scratch_process_exit);
+}
+#endif
+
+/* Get the locked scratch memory of the calling thread (at least XXH64PRNG_OS_SCRATCH_BYTES), returns NULL on failure */
+XXH64PRNG_API void *xxh64prng_os_scratch(void)
+{
+    scratch_page_t *page;
+
+#ifdef _WIN32
+    InitOnceExecuteOnce(&scratch_once, scratch_init, NULL, NULL);
+    if (scratch_key == FLS_OUT_OF_INDEXES) {
+        return NULL;
+    }
+    page = (scratch_page_t*)FlsGetValue(scratch_key);
+#else
+    pthread_once(&scratch_once, scratch_init);
+    if (!scratch_key_valid) {
+        return NULL;
+    }
+    page = (scratch_page_t*)pthread_getspecific(scratch_key);
+#endif
+
+    if (!page) {
+        page = scratch_alloc();
+#ifdef _WIN32
+        if (!FlsSetValue(scratch_key, page ? page : &scratch_none)) {
+#else
+        if (pthread_setspecific(scratch_key, page ? page : &scratch_none) != 0) {
+#endif
+            if (page) {
+                locked_free(page, page->size);
+            }
+            return NULL;
+        }
+        if (page) {
+            SCRATCH_LOCK();
+            if ((page->next = scratch_list)) {
+                scratch_list->prev = page;
+            }
+            scratch_list = page;
+            SCRATCH_UNLOCK();
+        }
+    }
+
+    return (page && (page != &scratch_none)) ? (((uint8_t*)page) + SCRATCH_HEADER) : NULL;
+}
+
+/* Wipe the scratch memory of *all* threads, must not be called while any thread is using it */
+XXH64PRNG_API void xxh64prng_os_scratch_wipe(void)
+{
+    scratch_page_t *page;
+
+    SCRATCH_LOCK();
+    for (page = scratch_list; page; page = page->next) {
+        xxh64prng_zero(((uint8_t*)page) + SCRATCH_HEADER, page->size - SCRATCH_HEADER);
+    }
+    SCRATCH_UNLOCK();
+}
@@ -0,0 +1,80 @@
+/*
+ * XXH64-PRNG
+ * Blazing fast XXH64-based secure pseudo-random number generator
+ *
+ * Copyright (c) 2025 "dEajL3kA" <Cumpoing79@web.de>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * https://www.opensource.org/licenses/bsd-license.php
+ */
+
+#ifndef _XXH64PRNG_OS_SUPPORT_H
+#define _XXH64PRNG_OS_SUPPORT_H
+
+#include <xxh64_prng.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/* opaque handles */
+typedef struct xxh64prng_os_thread xxh64prng_os_thread_t;
+typedef struct xxh64prng_os_monitor xxh64prng_os_monitor_t;
+
+/* one-time initialization flag, must be statically initialized to XXH64PRNG_OS_ONCE_INIT */
+#ifdef _WIN32
+typedef void *xxh64prng_os_once_t; /* same layout as INIT_ONCE */
+#  define XXH64PRNG_OS_ONCE_INIT NULL
+#else
+#  include <pthread.h>
+typedef pthread_once_t xxh64prng_os_once_t;
+#  define XXH64PRNG_OS_ONCE_INIT PTHREAD_ONCE_INIT
+#endif
+
+/* threads */
+XXH64PRNG_API xxh64prng_os_thread_t *xxh64prng_os_thread_create(void (*const func)(void*), void *const arg);
+XXH64PRNG_API void xxh64prng_os_thread_join(xxh64prng_os_thread_t *const thread);
+XXH64PRNG_API void xxh64prng_os_thread_yield(void);
+XXH64PRNG_API void xxh64prng_os_once(xxh64prng_os_once_t *const once, void (*const func)(void));
+
+/* monitor (mutex + condition variable) */
+XXH64PRNG_API xxh64prng_os_monitor_t *xxh64prng_os_monitor_create(void);
+XXH64PRNG_API void xxh64prng_os_monitor_destroy(xxh64prng_os_monitor_t *const monitor);
+XXH64PRNG_API void xxh64prng_os_monitor_enter(xxh64prng_os_monitor_t *const monitor);
+XXH64PRNG_API void xxh64prng_os_monitor_leave(xxh64prng_os_monitor_t *const monitor);
+XXH64PRNG_API void xxh64prng_os_monitor_wait(xxh64prng_os_monitor_t *const monitor);
+XXH64PRNG_API void xxh64prng_os_monitor_notify(xxh64prng_os_monitor_t *const monitor);
+
+/* locked per-thread scratch memory */
+#define XXH64PRNG_OS_SCRATCH_BYTES 1024U
+XXH64PRNG_API void *xxh64prng_os_scratch(void);
+XXH64PRNG_API void xxh64prng_os_scratch_wipe(void);
+
+/* system information */
+XXH64PRNG_API size_t xxh64prng_os_cpu_count(void);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /*_XXH64PRNG_OS_SUPPORT_H*/
@@ -40,6 +40,8 @@
  *   - xxHash source repository: https://github.com/Cyan4973/xxHash
  */
 
+#include <xxh64_prng.h>
+
 #include "xxh64.h"
 #include <string.h>
 
@@ -255,7 +257,67 @@ XXH_FORCE_INLINE uint64_t XXH64_endian_align(const uint8_t *input, const size_t
 	return XXH64_finalize(h64, input, len, align);
 }
 
-uint64_t XXH64(const void *const input, const size_t len, const uint64_t seed)
+XXH64PRNG_API uint64_t XXH64(const void *const input, const size_t len, const uint64_t seed)
 {
 	return XXH64_endian_align((const uint8_t*)input, len, seed, ((((uintptr_t)input) & 7) == 0) ? XXH_aligned : XXH_unaligned);
 }
+
+/* ======================================================================== */
+/* Streaming                                                                */
+/* ======================================================================== */
+
+XXH64PRNG_API uint64_t xxh64prng_hash(const void *const input, const size_t len, const uint64_t seed)
+{
+	return XXH64(input, len, seed);
+}
+
+XXH64PRNG_API void xxh64prng_hash_init(xxh64prng_hash_t *const hash, const uint64_t seed)
+{
+	memset(hash, 0, sizeof(xxh64prng_hash_t));
+	XXH64_initAccs(hash->acc, seed);
+	hash->seed = seed;
+}
+
+/* Whole 32-byte stripes are consumed directly from the input, only the rest is buffered */
+XXH64PRNG_API void xxh64prng_hash_update(xxh64prng_hash_t *const hash, const void *const input, size_t len)
+{
+	const uint8_t *ptr = (const uint8_t*)input;
+
+	hash->total_len += len;
+
+	if (hash->buffered + len < sizeof(hash->buffer)) {
+		if (len > 0U) {
+			memcpy(hash->buffer + hash->buffered, ptr, len);
+			hash->buffered += len;
+		}
+		return;
+	}
+
+	if (hash->buffered > 0U) {
+		const size_t fill = sizeof(hash->buffer) - hash->buffered;
+		memcpy(hash->buffer + hash->buffered, ptr, fill);
+		XXH64_consumeLong(hash->acc, hash->buffer, sizeof(hash->buffer), XXH_unaligned);
+		ptr += fill;
+		len -= fill;
+		hash->buffered = 0U;
+	}
+
+	if (len >= sizeof(hash->buffer)) {
+		const uint8_t *const end = XXH64_consumeLong(hash->acc, ptr, len, ((((uintptr_t)ptr) & 7) == 0) ? XXH_aligned : XXH_unaligned);
+		len -= (size_t)(end - ptr);
+		ptr = end;
+	}
+
+	if (len > 0U) {
+		memcpy(hash->buffer, ptr, len);
+		hash->buffered = len;
+	}
+}
+
+/* Returns the hash of all data so far, the state is not modified and can be updated further */
+XXH64PRNG_API uint64_t xxh64prng_hash_digest(const xxh64prng_hash_t *const hash)
+{
+	uint64_t h64 = (hash->total_len >= sizeof(hash->buffer)) ? XXH64_mergeAccs(hash->acc) : (hash->seed + XXH_PRIME64_5);
+	h64 += hash->total_len;
+	return XXH64_finalize(h64, hash->buffer, hash->buffered, XXH_unaligned);
+}
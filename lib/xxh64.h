@@ -51,11 +51,15 @@
 #  include <stdint.h>
 #endif
 
+#ifndef XXH64PRNG_API
+#define XXH64PRNG_API
+#endif
+
 #if defined(__cplusplus)
 extern "C" {
 #endif
 
-uint64_t XXH64(const void *const input, const size_t len, const uint64_t seed);
+XXH64PRNG_API uint64_t XXH64(const void *const input, const size_t len, const uint64_t seed);
 
 #if defined(__cplusplus)
 }
@@ -32,12 +32,23 @@
 
 #include "version.h"
 #include "xxh64.h"
+#include "xxh64_simd.h"
+#include "xxh64_prng_core.h"
+#include "os_support.h"
 #include <string.h>
 
 #ifndef ENABLE_DEBUG_LOGGING
 #define ENABLE_DEBUG_LOGGING 0
 #endif
 
+#ifndef ENABLE_TEST_HOOKS
+#define ENABLE_TEST_HOOKS 0
+#endif
+
+#ifndef XXH64PRNG_WIPE_DEFAULT
+#define XXH64PRNG_WIPE_DEFAULT XXH64PRNG_WIPE_PARANOID
+#endif
+
 #if defined(__GNUC__) || defined(__clang__)
 #  define FORCE_INLINE __inline__ __attribute__((__always_inline__))
 #elif defined(_MSC_VER)
@@ -48,6 +59,19 @@
 #  define FORCE_INLINE
 #endif
 
+#if defined(_MSC_VER) && !defined(__clang__)
+#  include <intrin.h>
+#  define STATS_ATOMIC_ADD(PTR, VALUE) ((void)_InterlockedExchangeAdd64((volatile __int64*)(PTR), (__int64)(VALUE)))
+#  define STATS_ATOMIC_LOAD(PTR) ((uint64_t)_InterlockedCompareExchange64((volatile __int64*)(PTR), 0, 0))
+#  define POINTER_LOAD(PTR) _InterlockedCompareExchangePointer((void *volatile*)(PTR), NULL, NULL)
+#  define POINTER_STORE(PTR, VALUE) ((void)_InterlockedExchangePointer((void *volatile*)(PTR), (void*)(VALUE)))
+#else
+#  define STATS_ATOMIC_ADD(PTR, VALUE) ((void)__atomic_fetch_add((PTR), (VALUE), __ATOMIC_RELAXED))
+#  define STATS_ATOMIC_LOAD(PTR) __atomic_load_n((PTR), __ATOMIC_RELAXED)
+#  define POINTER_LOAD(PTR) ((void*)__atomic_load_n((PTR), __ATOMIC_ACQUIRE))
+#  define POINTER_STORE(PTR, VALUE) __atomic_store_n((PTR), (VALUE), __ATOMIC_RELEASE)
+#endif
+
 #if defined(__BIG_ENDIAN__) || (defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__))
 #  error Big-endian is not currently supported!
 #endif
@@ -56,12 +80,12 @@
 /* Version                                                                  */
 /* ======================================================================== */
 
-const uint16_t XXH64PRNG_VERSION_MAJOR = _XXH64PRNG_VERSION_MAJOR;
-const uint16_t XXH64PRNG_VERSION_MINOR = _XXH64PRNG_VERSION_MINOR;
-const uint16_t XXH64PRNG_VERSION_PATCH = _XXH64PRNG_VERSION_PATCH;
+_XXH64PRNG_DATA const uint16_t XXH64PRNG_VERSION_MAJOR = _XXH64PRNG_VERSION_MAJOR;
+_XXH64PRNG_DATA const uint16_t XXH64PRNG_VERSION_MINOR = _XXH64PRNG_VERSION_MINOR;
+_XXH64PRNG_DATA const uint16_t XXH64PRNG_VERSION_PATCH = _XXH64PRNG_VERSION_PATCH;
 
-const char* const XXH64PRNG_DATE = __DATE__;
-const char* const XXH64PRNG_ARCH = _XXH64PRNG_ARCH;
+_XXH64PRNG_DATA const char* const XXH64PRNG_DATE = __DATE__;
+_XXH64PRNG_DATA const char* const XXH64PRNG_ARCH = _XXH64PRNG_ARCH;
 
 /* ======================================================================== */
 /* Debug Logging                                                            */
@@ -112,7 +136,7 @@ static const char *const INIT_1[_XXH64PRNG_STATE_WORDS] = {
 };
 
 /* Initialize state from a small 64-Bit seed */
-void xxh64prng_init(xxh64prng_t *const state, const uint64_t seed)
+XXH64PRNG_API void xxh64prng_init(xxh64prng_t *const state, const uint64_t seed)
 {
     size_t pos;
     const char *const *init0 = INIT_0, *const *init1 = INIT_1;
@@ -154,11 +178,142 @@ static const uint64_t SEED[XXH64PRNG_OUTPUT_WORDS] = {
     UINT64_C(0x4AFCB56C2DD1D35B), UINT64_C(0x9A53E479B6F84565), UINT64_C(0xD28E49BC4BFB9790), UINT64_C(0xE1DDF2DAA4CB7E33)
 };
 
-/* Internal function to iterate the state */
-static FORCE_INLINE void xxh64prng_step(uint64_t *const state, uint64_t *const value)
+/* Output function kernels of one implementation, all implementations produce identical results */
+typedef struct xxh64prng_kernels {
+    xxh64prng_impl_t impl;
+    xxh64_multiseed_t multiseed;
+    xxh64_multistate_t multistate;
+    xxh64_stripes_t stripes; /* may be NULL */
+} xxh64prng_kernels_t;
+
+/* The tables are filled in once and never modified afterwards; the selected table is published through a single atomic pointer */
+#define KERNEL_TABLES ((size_t)XXH64PRNG_IMPL_NEON + 1U)
+static xxh64prng_kernels_t xxh64prng_kernel_tables[KERNEL_TABLES];
+static const xxh64prng_kernels_t *xxh64prng_kernels = NULL;
+static xxh64prng_os_once_t xxh64prng_kernels_once = XXH64PRNG_OS_ONCE_INIT;
+
+/* Internal function to fill in the kernel tables and select the fastest implementation, called exactly once */
+static void xxh64prng_kernels_init(void)
+{
+    size_t impl;
+
+    for (impl = (size_t)XXH64PRNG_IMPL_SCALAR; impl < KERNEL_TABLES; ++impl) {
+        xxh64prng_kernels_t *const table = &xxh64prng_kernel_tables[impl];
+        table->impl = (xxh64prng_impl_t)impl;
+        table->multiseed = XXH64_multiseed_kernel(table->impl);
+        table->multistate = XXH64_multistate_kernel(table->impl);
+        table->stripes = XXH64_stripes_kernel(table->impl);
+    }
+
+    POINTER_STORE(&xxh64prng_kernels, &xxh64prng_kernel_tables[XXH64_multiseed_detect()]);
+}
+
+/* Internal function to get the kernel table currently in use; callers load it once and use that table throughout */
+static FORCE_INLINE const xxh64prng_kernels_t *xxh64prng_kernels_get(void)
+{
+    const xxh64prng_kernels_t *kernels = (const xxh64prng_kernels_t*)POINTER_LOAD(&xxh64prng_kernels);
+
+    if (!kernels) {
+        xxh64prng_os_once(&xxh64prng_kernels_once, xxh64prng_kernels_init);
+        kernels = (const xxh64prng_kernels_t*)POINTER_LOAD(&xxh64prng_kernels);
+    }
+
+    return kernels;
+}
+
+#if ENABLE_TEST_HOOKS
+_XXH64PRNG_DATA size_t xxh64prng_test_force_retry = 0U;
+#  define FORCE_RETRY() (xxh64prng_test_force_retry && xxh64prng_test_force_retry--)
+#else
+#  define FORCE_RETRY() 0
+#endif
+
+/* Statistics counters, NULL = disabled; the pointer is loaded once per update, so it can be swapped while other threads are generating */
+static xxh64prng_stats_t *xxh64prng_stats = NULL;
+#define STATS_ADD(FIELD, VALUE) do { \
+    xxh64prng_stats_t *const stats_counters = (xxh64prng_stats_t*)POINTER_LOAD(&xxh64prng_stats); \
+    if (stats_counters) { STATS_ATOMIC_ADD(&stats_counters->FIELD, (uint64_t)(VALUE)); } \
+} while (0)
+
+/* Memory wiping policy, the default can be changed at build time */
+static xxh64prng_wipe_t xxh64prng_wipe = XXH64PRNG_WIPE_DEFAULT;
+
+/* Slots in the scratch memory of the calling thread */
+#define SCRATCH_ADVANCE 0U
+#define SCRATCH_BLOCK 1U
+
+/* Get buffer for temporaries: the locked scratch memory in "wipe on destroy" mode, otherwise the "local" buffer */
+static FORCE_INLINE uint64_t *xxh64prng_temp_acquire(uint64_t *const local, const size_t slot)
+{
+    uint64_t *scratch;
+    if ((xxh64prng_wipe == XXH64PRNG_WIPE_ON_DESTROY) && ((scratch = (uint64_t*)xxh64prng_os_scratch()) != NULL)) {
+        return scratch + (slot * _XXH64PRNG_TEMP_WORDS);
+    }
+    return local;
+}
+
+/* Release buffer for temporaries: the "local" buffer is wiped immediately, unless wiping is turned off */
+static FORCE_INLINE void xxh64prng_temp_release(uint64_t *const temp, uint64_t *const local)
+{
+    if ((temp == local) && (xxh64prng_wipe != XXH64PRNG_WIPE_OFF)) {
+        xxh64prng_zero(local, _XXH64PRNG_TEMP_WORDS * sizeof(uint64_t));
+    }
+}
+
+/* Internal function to compute one round of the state iteration, consuming the next 16 seeds */
+static FORCE_INLINE void xxh64prng_step_round(uint64_t *const state, uint64_t *const value, const uint64_t *const temp0, const uint64_t *const temp1, const uint64_t *const seed)
+{
+    uint64_t seed0[_XXH64PRNG_STATE_WORDS];
+    uint64_t seed1[_XXH64PRNG_STATE_WORDS];
+    const xxh64prng_kernels_t *const kernels = xxh64prng_kernels_get();
+    size_t pos;
+
+    for (pos = 0U; pos < _XXH64PRNG_STATE_WORDS; ++pos) {
+        seed0[pos] = seed[2U * pos];
+        seed1[pos] = seed[(2U * pos) + 1U];
+    }
+    kernels->multiseed(temp0, seed0, value, _XXH64PRNG_STATE_WORDS);
+    kernels->multiseed(temp1, seed1, state, _XXH64PRNG_STATE_WORDS);
+    for (pos = 0U; pos < _XXH64PRNG_STATE_WORDS; ++pos) {
+        value[pos] ^= temp0[pos];
+        state[pos] ^= temp1[pos];
+    }
+}
+
+/* The round is repeated (with the next seeds) while the state did not change */
+#define STEP_REPEAT(STATE, TEMP0) ((!memcmp((STATE), (TEMP0), _XXH64PRNG_STATE_BYTES)) || FORCE_RETRY())
+
+/* Internal function to iterate the state, "work" receives the (secret) temporaries */
+static FORCE_INLINE void xxh64prng_step(uint64_t *const state, uint64_t *const value, uint64_t *const work)
 {
-    uint64_t temp0[_XXH64PRNG_STATE_WORDS];
-    uint64_t temp1[_XXH64PRNG_STATE_WORDS];
+    uint64_t *const temp0 = work;
+    uint64_t *const temp1 = work + _XXH64PRNG_STATE_WORDS;
+    size_t pos;
+    const uint64_t* seed = SEED;
+
+    for (pos = 0U; pos < _XXH64PRNG_STATE_WORDS; ++pos) {
+        temp0[pos] = state[pos];
+        temp1[pos] = state[pos] ^ UINT64_MAX;
+    }
+
+    do {
+        xxh64prng_step_round(state, value, temp0, temp1, seed);
+        seed += _XXH64PRNG_TEMP_WORDS;
+    } while (STEP_REPEAT(state, temp0));
+
+    STATS_ADD(steps, 1U);
+    if (seed != (SEED + _XXH64PRNG_TEMP_WORDS)) {
+        STATS_ADD(retries, 1U);
+    }
+}
+
+/* Internal function to iterate the state only: the state does not depend on the intermediate value, so it is not computed */
+static FORCE_INLINE void xxh64prng_step_state(uint64_t *const state, uint64_t *const work)
+{
+    uint64_t *const temp0 = work;
+    uint64_t *const temp1 = work + _XXH64PRNG_STATE_WORDS;
+    uint64_t seed1[_XXH64PRNG_STATE_WORDS];
+    const xxh64prng_kernels_t *const kernels = xxh64prng_kernels_get();
     size_t pos;
     const uint64_t* seed = SEED;
 
@@ -169,39 +324,750 @@ static FORCE_INLINE void xxh64prng_step(uint64_t *const state, uint64_t *const v
 
     do {
         for (pos = 0U; pos < _XXH64PRNG_STATE_WORDS; ++pos) {
-            value[pos] = XXH64(temp0, _XXH64PRNG_STATE_BYTES, *seed++) ^ temp0[pos];
-            state[pos] = XXH64(temp1, _XXH64PRNG_STATE_BYTES, *seed++) ^ temp1[pos];
+            seed1[pos] = seed[(2U * pos) + 1U];
         }
-    } while (!memcmp(state, temp0, _XXH64PRNG_STATE_BYTES));
+        kernels->multiseed(temp1, seed1, state, _XXH64PRNG_STATE_WORDS);
+        for (pos = 0U; pos < _XXH64PRNG_STATE_WORDS; ++pos) {
+            state[pos] ^= temp1[pos];
+        }
+        seed += _XXH64PRNG_TEMP_WORDS;
+    } while (STEP_REPEAT(state, temp0));
 
-    xxh64prng_zero(temp0, sizeof(temp0));
-    xxh64prng_zero(temp1, sizeof(temp1));
+    STATS_ADD(steps, 1U);
+    if (seed != (SEED + _XXH64PRNG_TEMP_WORDS)) {
+        STATS_ADD(retries, 1U);
+    }
 }
 
-/* Generate the next ouput block */
-void xxh64prng_next(xxh64prng_t *const state, uint64_t *const out)
+/* Iterate the state and compute the intermediate values of the next block */
+XXH64PRNG_API void xxh64prng_core_advance(xxh64prng_t *const state, uint64_t *const temp)
 {
-    uint64_t temp0[_XXH64PRNG_STATE_WORDS];
-    uint64_t temp1[_XXH64PRNG_STATE_WORDS];
-    size_t pos;
-    const uint64_t *seed = SEED;
+    uint64_t local[_XXH64PRNG_TEMP_WORDS];
+    uint64_t *work;
 
 #if ENABLE_DEBUG_LOGGING
     xxh64prng_printstate(stderr, "state", state->state);
 #endif
 
-    xxh64prng_step(state->state, temp0);
-    xxh64prng_step(state->state, temp1);
+    work = xxh64prng_temp_acquire(local, SCRATCH_ADVANCE);
+    xxh64prng_step(state->state, temp, work);
+    xxh64prng_step(state->state, temp + _XXH64PRNG_STATE_WORDS, work);
+    xxh64prng_temp_release(work, local);
 
 #if ENABLE_DEBUG_LOGGING
-    xxh64prng_printstate(stderr, "temp0", temp0);
-    xxh64prng_printstate(stderr, "temp1", temp1);
+    xxh64prng_printstate(stderr, "temp0", temp);
+    xxh64prng_printstate(stderr, "temp1", temp + _XXH64PRNG_STATE_WORDS);
 #endif
+}
+
+/* Internal function to expand the intermediate values into the first "count" words of an output block */
+static FORCE_INLINE void xxh64prng_expand_words(const uint64_t *const temp, void *const out, const size_t count)
+{
+    const xxh64prng_kernels_t *const kernels = xxh64prng_kernels_get();
+    kernels->multiseed(temp, SEED, out, count);
+    kernels->multiseed(temp + _XXH64PRNG_STATE_WORDS, out, out, count);
+    STATS_ADD(blocks, 1U);
+}
+
+/* Expand the intermediate values into an output block, "out" may be unaligned */
+XXH64PRNG_API void xxh64prng_core_expand(const uint64_t *const temp, void *const out)
+{
+    xxh64prng_expand_words(temp, out, XXH64PRNG_OUTPUT_WORDS);
+}
+
+/* Internal function to generate the first "count" words of the next output block, "out" may be unaligned */
+static FORCE_INLINE void xxh64prng_next_words(xxh64prng_t *const state, void *const out, const size_t count)
+{
+    uint64_t local[_XXH64PRNG_TEMP_WORDS];
+    uint64_t *const temp = xxh64prng_temp_acquire(local, SCRATCH_BLOCK);
+
+    xxh64prng_core_advance(state, temp);
+    xxh64prng_expand_words(temp, out, count);
+
+    xxh64prng_temp_release(temp, local);
+}
+
+/* Internal function to generate the next output block, "out" may be unaligned */
+static FORCE_INLINE void xxh64prng_next_block(xxh64prng_t *const state, void *const out)
+{
+    xxh64prng_next_words(state, out, XXH64PRNG_OUTPUT_WORDS);
+}
+
+/* Generate the next ouput block */
+XXH64PRNG_API void xxh64prng_next(xxh64prng_t *const state, uint64_t *const out)
+{
+    xxh64prng_next_block(state, out);
+}
+
+/* Generate only the first "count" words of the next output block, the state is iterated just like by xxh64prng_next() */
+XXH64PRNG_API void xxh64prng_next_partial(xxh64prng_t *const state, uint64_t *const out, const size_t count)
+{
+    xxh64prng_next_words(state, out, (count < XXH64PRNG_OUTPUT_WORDS) ? count : XXH64PRNG_OUTPUT_WORDS);
+}
+
+/* Skip the next "nblocks" output blocks, by iterating the state only; this is about 14 times faster than generating them */
+XXH64PRNG_API void xxh64prng_discard(xxh64prng_t *const state, uint64_t nblocks)
+{
+    uint64_t local[_XXH64PRNG_TEMP_WORDS];
+    uint64_t *work;
+
+    work = xxh64prng_temp_acquire(local, SCRATCH_ADVANCE);
+    for (; nblocks > 0U; --nblocks) {
+        xxh64prng_step_state(state->state, work);
+        xxh64prng_step_state(state->state, work);
+    }
+    xxh64prng_temp_release(work, local);
+}
+
+/* Number of bytes, of a request of "len" bytes, that end on a block boundary, if the current block has "avail" bytes left */
+static FORCE_INLINE size_t xxh64prng_whole_blocks(const size_t len, const size_t avail)
+{
+    return (len > avail) ? (avail + (((len - avail) / XXH64PRNG_OUTPUT_BYTES) * XXH64PRNG_OUTPUT_BYTES)) : len;
+}
+
+/* Number of words that contain the first "len" bytes */
+#define WORDS_FOR(LEN) (((LEN) + sizeof(uint64_t) - 1U) / sizeof(uint64_t))
+
+/* ======================================================================== */
+/* Interleaved generator                                                    */
+/* ======================================================================== */
+
+/*
+ * Advances 4 or 8 independent states together. The state iteration of a single
+ * state is a chain of short, dependent kernel calls that leaves the multiplier
+ * pipelines mostly idle, so the states, and the temporaries of the iteration,
+ * are kept in "structure of arrays" layout (word "i" of lane "l" at position
+ * [i * lanes + l]) and the multi-state kernel advances all of them in one go.
+ * The expansion of each block already is vectorized across the seeds, so it is
+ * done per lane, exactly as in the single-state case. The temporaries of the
+ * interleaved iteration are always wiped immediately (unless wiping is turned
+ * off), because they do not fit into the scratch memory.
+ */
 
-    for (pos = 0U; pos < XXH64PRNG_OUTPUT_WORDS; ++pos) {
-        out[pos] = XXH64(temp1, _XXH64PRNG_STATE_BYTES, XXH64(temp0, _XXH64PRNG_STATE_BYTES, *seed++));
+#define LANES_MAX 8U
+
+/* Fill "rows" with the seeds seed[0], seed[2], ..., seed[14], each one repeated for all lanes */
+static FORCE_INLINE void xxh64prng_lanes_broadcast(uint64_t *const rows, const uint64_t *const seed, const size_t lanes)
+{
+    size_t pos, lane;
+    for (pos = 0U; pos < _XXH64PRNG_STATE_WORDS; ++pos) {
+        for (lane = 0U; lane < lanes; ++lane) {
+            rows[(pos * lanes) + lane] = seed[2U * pos];
+        }
     }
+}
+
+/* Copy one lane from "structure of arrays" layout to a contiguous array, or vice versa */
+static FORCE_INLINE void xxh64prng_lanes_get(uint64_t *const dst, const uint64_t *const src, const size_t lane, const size_t lanes)
+{
+    size_t pos;
+    for (pos = 0U; pos < _XXH64PRNG_STATE_WORDS; ++pos) {
+        dst[pos] = src[(pos * lanes) + lane];
+    }
+}
 
-    xxh64prng_zero(temp0, sizeof(temp0));
-    xxh64prng_zero(temp1, sizeof(temp1));
+static FORCE_INLINE void xxh64prng_lanes_put(uint64_t *const dst, const uint64_t *const src, const size_t lane, const size_t lanes)
+{
+    size_t pos;
+    for (pos = 0U; pos < _XXH64PRNG_STATE_WORDS; ++pos) {
+        dst[(pos * lanes) + lane] = src[pos];
+    }
+}
+
+static FORCE_INLINE bool xxh64prng_lanes_equal(const uint64_t *const a, const uint64_t *const b, const size_t lane, const size_t lanes)
+{
+    size_t pos;
+    for (pos = 0U; pos < _XXH64PRNG_STATE_WORDS; ++pos) {
+        if (a[(pos * lanes) + lane] != b[(pos * lanes) + lane]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/* Internal function to iterate the interleaved states, "work" receives the (secret) temporaries */
+static void xxh64prng_step_lanes(uint64_t *const state, uint64_t *const value, uint64_t *const work, const size_t lanes)
+{
+    uint64_t *const temp0 = work;
+    uint64_t *const temp1 = work + (_XXH64PRNG_STATE_WORDS * lanes);
+    uint64_t lane_work[4U * _XXH64PRNG_STATE_WORDS];
+    const xxh64prng_kernels_t *const kernels = xxh64prng_kernels_get();
+    size_t pos, lane;
+    const uint64_t* seed;
+
+    for (pos = 0U; pos < _XXH64PRNG_STATE_WORDS * lanes; ++pos) {
+        temp0[pos] = state[pos];
+        temp1[pos] = state[pos] ^ UINT64_MAX;
+    }
+
+    /* the kernels allow in-place operation, so the seeds are put into the output arrays */
+    xxh64prng_lanes_broadcast(value, SEED, lanes);
+    xxh64prng_lanes_broadcast(state, SEED + 1U, lanes);
+    kernels->multistate(temp0, value, value, lanes, _XXH64PRNG_STATE_WORDS);
+    kernels->multistate(temp1, state, state, lanes, _XXH64PRNG_STATE_WORDS);
+    for (pos = 0U; pos < _XXH64PRNG_STATE_WORDS * lanes; ++pos) {
+        value[pos] ^= temp0[pos];
+        state[pos] ^= temp1[pos];
+    }
+
+    /* a repeated round is (practically) never required, so it is done one lane at a time */
+    STATS_ADD(steps, lanes);
+    for (lane = 0U; lane < lanes; ++lane) {
+        if (xxh64prng_lanes_equal(state, temp0, lane, lanes) || FORCE_RETRY()) {
+            uint64_t *const lane_state = lane_work, *const lane_value = lane_work + _XXH64PRNG_STATE_WORDS;
+            uint64_t *const lane_temp0 = lane_work + (2U * _XXH64PRNG_STATE_WORDS), *const lane_temp1 = lane_work + (3U * _XXH64PRNG_STATE_WORDS);
+            xxh64prng_lanes_get(lane_temp0, temp0, lane, lanes);
+            xxh64prng_lanes_get(lane_temp1, temp1, lane, lanes);
+            seed = SEED;
+            do {
+                seed += _XXH64PRNG_TEMP_WORDS;
+                xxh64prng_step_round(lane_state, lane_value, lane_temp0, lane_temp1, seed);
+            } while (STEP_REPEAT(lane_state, lane_temp0));
+            STATS_ADD(retries, 1U);
+            xxh64prng_lanes_put(state, lane_state, lane, lanes);
+            xxh64prng_lanes_put(value, lane_value, lane, lanes);
+            if (xxh64prng_wipe != XXH64PRNG_WIPE_OFF) {
+                xxh64prng_zero(lane_work, sizeof(lane_work));
+            }
+        }
+    }
+}
+
+/* Internal function to generate the next output block of each of the interleaved states */
+static void xxh64prng_next_lanes(uint64_t *const state, uint64_t *const out, const size_t lanes)
+{
+    uint64_t work[_XXH64PRNG_TEMP_WORDS * LANES_MAX];
+    uint64_t temp[_XXH64PRNG_TEMP_WORDS * LANES_MAX];
+    uint64_t local[_XXH64PRNG_TEMP_WORDS];
+    uint64_t *lane_temp;
+    size_t lane;
+
+    xxh64prng_step_lanes(state, temp, work, lanes);
+    xxh64prng_step_lanes(state, temp + (_XXH64PRNG_STATE_WORDS * lanes), work, lanes);
+
+    lane_temp = xxh64prng_temp_acquire(local, SCRATCH_BLOCK);
+    for (lane = 0U; lane < lanes; ++lane) {
+        xxh64prng_lanes_get(lane_temp, temp, lane, lanes);
+        xxh64prng_lanes_get(lane_temp + _XXH64PRNG_STATE_WORDS, temp + (_XXH64PRNG_STATE_WORDS * lanes), lane, lanes);
+        xxh64prng_core_expand(lane_temp, out + (lane * XXH64PRNG_OUTPUT_WORDS));
+    }
+    xxh64prng_temp_release(lane_temp, local);
+
+    if (xxh64prng_wipe != XXH64PRNG_WIPE_OFF) {
+        xxh64prng_zero(work, _XXH64PRNG_TEMP_WORDS * lanes * sizeof(uint64_t));
+        xxh64prng_zero(temp, _XXH64PRNG_TEMP_WORDS * lanes * sizeof(uint64_t));
+    }
+}
+
+/* Interleave 4 states */
+XXH64PRNG_API void xxh64prng_x4_load(xxh64prng_x4_t *const states, const xxh64prng_t *const src)
+{
+    size_t lane;
+    for (lane = 0U; lane < 4U; ++lane) {
+        xxh64prng_lanes_put(&states->state[0U][0U], src[lane].state, lane, 4U);
+    }
+}
+
+/* De-interleave 4 states */
+XXH64PRNG_API void xxh64prng_x4_store(const xxh64prng_x4_t *const states, xxh64prng_t *const dst)
+{
+    size_t lane;
+    for (lane = 0U; lane < 4U; ++lane) {
+        xxh64prng_lanes_get(dst[lane].state, &states->state[0U][0U], lane, 4U);
+    }
+}
+
+/* Generate the next output block of each of the 4 states */
+XXH64PRNG_API void xxh64prng_next_x4(xxh64prng_x4_t *const states, uint64_t *const out)
+{
+    xxh64prng_next_lanes(&states->state[0U][0U], out, 4U);
+}
+
+/* Interleave 8 states */
+XXH64PRNG_API void xxh64prng_x8_load(xxh64prng_x8_t *const states, const xxh64prng_t *const src)
+{
+    size_t lane;
+    for (lane = 0U; lane < 8U; ++lane) {
+        xxh64prng_lanes_put(&states->state[0U][0U], src[lane].state, lane, 8U);
+    }
+}
+
+/* De-interleave 8 states */
+XXH64PRNG_API void xxh64prng_x8_store(const xxh64prng_x8_t *const states, xxh64prng_t *const dst)
+{
+    size_t lane;
+    for (lane = 0U; lane < 8U; ++lane) {
+        xxh64prng_lanes_get(dst[lane].state, &states->state[0U][0U], lane, 8U);
+    }
+}
+
+/* Generate the next output block of each of the 8 states */
+XXH64PRNG_API void xxh64prng_next_x8(xxh64prng_x8_t *const states, uint64_t *const out)
+{
+    xxh64prng_next_lanes(&states->state[0U][0U], out, 8U);
+}
+
+/* ======================================================================== */
+/* Bulk generator                                                           */
+/* ======================================================================== */
+
+/* Initialize stream from an (already initialized) PRNG state */
+XXH64PRNG_API void xxh64prng_stream_init(xxh64prng_stream_t *const stream, const xxh64prng_t *const state)
+{
+    stream->prng = *state;
+    stream->offset = XXH64PRNG_OUTPUT_BYTES;
+}
+
+/* Fill buffer of arbitrary size and alignment with random bytes */
+XXH64PRNG_API void xxh64prng_fill(xxh64prng_stream_t *const stream, void *const buf, size_t len)
+{
+    uint8_t *out = (uint8_t*)buf;
+
+    if (stream->offset < XXH64PRNG_OUTPUT_BYTES) {
+        const size_t avail = XXH64PRNG_OUTPUT_BYTES - stream->offset;
+        const size_t chunk_size = (len < avail) ? len : avail;
+        memcpy(out, ((const uint8_t*)stream->block) + stream->offset, chunk_size);
+        stream->offset += chunk_size;
+        out += chunk_size;
+        len -= chunk_size;
+    }
+
+    while (len >= XXH64PRNG_OUTPUT_BYTES) {
+        xxh64prng_next_block(&stream->prng, out);
+        out += XXH64PRNG_OUTPUT_BYTES;
+        len -= XXH64PRNG_OUTPUT_BYTES;
+    }
+
+    if (len > 0U) {
+        xxh64prng_next_block(&stream->prng, stream->block);
+        memcpy(out, stream->block, len);
+        stream->offset = len;
+    }
+}
+
+/* Skip the next "len" bytes of the stream, only the block containing the new position is generated */
+XXH64PRNG_API void xxh64prng_skip(xxh64prng_stream_t *const stream, uint64_t len)
+{
+    const size_t avail = XXH64PRNG_OUTPUT_BYTES - stream->offset;
+
+    if (len <= avail) {
+        stream->offset += (size_t)len;
+        return;
+    }
+
+    len -= avail;
+    xxh64prng_discard(&stream->prng, len / XXH64PRNG_OUTPUT_BYTES);
+    stream->offset = XXH64PRNG_OUTPUT_BYTES;
+
+    if (len % XXH64PRNG_OUTPUT_BYTES) {
+        xxh64prng_next_block(&stream->prng, stream->block);
+        stream->offset = (size_t)(len % XXH64PRNG_OUTPUT_BYTES);
+    }
+}
+
+/* Fill buffer like xxh64prng_fill(), but drop the remainder of the last block, so it does not need to be computed */
+XXH64PRNG_API void xxh64prng_fill_final(xxh64prng_stream_t *const stream, void *const buf, const size_t len)
+{
+    const size_t head = xxh64prng_whole_blocks(len, XXH64PRNG_OUTPUT_BYTES - stream->offset);
+
+    xxh64prng_fill(stream, buf, head);
+
+    if (len > head) {
+        xxh64prng_next_words(&stream->prng, stream->block, WORDS_FOR(len - head));
+        memcpy(((uint8_t*)buf) + head, stream->block, len - head);
+    }
+
+    stream->offset = XXH64PRNG_OUTPUT_BYTES;
+}
+
+/* ======================================================================== */
+/* Substream derivation                                                     */
+/* ======================================================================== */
+
+#define DERIVE_BATCH 64U
+
+/* Hexadecimal digits of the square root of 2 */
+static const uint64_t DERIVE[2U * _XXH64PRNG_STATE_WORDS] = {
+    UINT64_C(0x6A09E667F3BCC908), UINT64_C(0xB2FB1366EA957D3E), UINT64_C(0x3ADEC17512775099), UINT64_C(0xDA2F590B0667322A),
+    UINT64_C(0x95F9060875714587), UINT64_C(0x5163FCDFB907B672), UINT64_C(0x1EE950BC8738F694), UINT64_C(0xF0090E6C7BF44ED1),
+    UINT64_C(0xA4405D0E855E3E9C), UINT64_C(0xA60B38C0237866F7), UINT64_C(0x956379222D108B14), UINT64_C(0x8C1578E45EF89C67),
+    UINT64_C(0x8DAB5147176FD3B9), UINT64_C(0x9654C68663E7909B), UINT64_C(0xEA5E241F06DCB05D), UINT64_C(0xD549411320819495)
+};
+
+/* Derive "count" child states with consecutive identifiers from the parent state */
+XXH64PRNG_API void xxh64prng_derive_batch(xxh64prng_t *const children, const size_t count, const xxh64prng_t *const parent, const uint64_t first_id)
+{
+    uint64_t key[_XXH64PRNG_STATE_WORDS];
+    uint64_t seed[DERIVE_BATCH * _XXH64PRNG_STATE_WORDS];
+    const xxh64prng_kernels_t *const kernels = xxh64prng_kernels_get();
+    size_t offset, pos, word;
+
+    /* domain-separated key, never used as-is by the generator */
+    kernels->multiseed(parent->state, DERIVE, key, _XXH64PRNG_STATE_WORDS);
+
+    for (offset = 0U; offset < count; offset += DERIVE_BATCH) {
+        const size_t batch = ((count - offset) < DERIVE_BATCH) ? (count - offset) : DERIVE_BATCH;
+        for (pos = 0U; pos < batch; ++pos) {
+            for (word = 0U; word < _XXH64PRNG_STATE_WORDS; ++word) {
+                seed[(pos * _XXH64PRNG_STATE_WORDS) + word] = (first_id + offset + pos) ^ DERIVE[_XXH64PRNG_STATE_WORDS + word];
+            }
+        }
+        kernels->multiseed(key, seed, children + offset, batch * _XXH64PRNG_STATE_WORDS);
+    }
+
+    if (xxh64prng_wipe != XXH64PRNG_WIPE_OFF) {
+        xxh64prng_zero(key, sizeof(key));
+    }
+}
+
+/* Derive a single child state from the parent state */
+XXH64PRNG_API void xxh64prng_derive(xxh64prng_t *const child, const xxh64prng_t *const parent, const uint64_t id)
+{
+    xxh64prng_derive_batch(child, 1U, parent, id);
+}
+
+/* ======================================================================== */
+/* Counter mode                                                             */
+/* ======================================================================== */
+
+/* Hexadecimal digits of the square root of 3 */
+static const uint64_t COUNTER[3U * _XXH64PRNG_STATE_WORDS] = {
+    UINT64_C(0xBB67AE8584CAA73B), UINT64_C(0x25742D7078B83B89), UINT64_C(0x25D834CC53DA4798), UINT64_C(0xC720A6486E45A6E2),
+    UINT64_C(0x490BCFD95EF15DBD), UINT64_C(0xA9930AAE12228F87), UINT64_C(0xCC4CF24DA3A1EC68), UINT64_C(0xD0CD33A01AD9A383),
+    UINT64_C(0xB9E122E6138C3AE6), UINT64_C(0xDE5EDE3BD42DB730), UINT64_C(0x1B6BF553AF7B09FD), UINT64_C(0x6EBEF33A9A9FE577),
+    UINT64_C(0x29426F30E5892AB5), UINT64_C(0x72816CCEFC589935), UINT64_C(0x5F7F11C3E24F3768), UINT64_C(0xA5C7CB90D5530250),
+    UINT64_C(0x5DF014C70ADB1EC1), UINT64_C(0xBAF58F084433C0D5), UINT64_C(0x6696A039D962D843), UINT64_C(0x4194AAB164D642F7),
+    UINT64_C(0x6E2C8F7DBED64B39), UINT64_C(0xDAD2F9F7726C6930), UINT64_C(0xC49D48FFCDC21114), UINT64_C(0xA6C36B2AB7018AF6)
+};
+
+/* Compute the intermediate values of block "index" directly from the key */
+XXH64PRNG_API void xxh64prng_core_counter(const uint64_t *const key, const uint64_t index, uint64_t *const temp)
+{
+    uint64_t seed[_XXH64PRNG_TEMP_WORDS];
+    const xxh64prng_kernels_t *const kernels = xxh64prng_kernels_get();
+    size_t pos;
+
+    for (pos = 0U; pos < _XXH64PRNG_TEMP_WORDS; ++pos) {
+        seed[pos] = index ^ COUNTER[_XXH64PRNG_STATE_WORDS + pos];
+    }
+
+    kernels->multiseed(key, seed, temp, _XXH64PRNG_TEMP_WORDS);
+}
+
+/* Initialize counter mode context from an (already initialized) PRNG state */
+XXH64PRNG_API void xxh64prng_ctr_init(xxh64prng_ctr_t *const ctr, const xxh64prng_t *const key)
+{
+    const xxh64prng_kernels_t *const kernels = xxh64prng_kernels_get();
+
+    /* domain-separated key, never used as-is by the generator */
+    kernels->multiseed(key->state, COUNTER, ctr->key, _XXH64PRNG_STATE_WORDS);
+    ctr->counter = 0U;
+    ctr->offset = XXH64PRNG_OUTPUT_BYTES;
+}
+
+/* Internal function to generate the first "count" words of output block "index" */
+static FORCE_INLINE void xxh64prng_ctr_words(const xxh64prng_ctr_t *const ctr, const uint64_t index, void *const out, const size_t count)
+{
+    uint64_t local[_XXH64PRNG_TEMP_WORDS];
+    uint64_t *const temp = xxh64prng_temp_acquire(local, SCRATCH_BLOCK);
+
+    xxh64prng_core_counter(ctr->key, index, temp);
+    xxh64prng_expand_words(temp, out, count);
+
+    xxh64prng_temp_release(temp, local);
+}
+
+/* Generate output block "index", without modifying the context */
+XXH64PRNG_API void xxh64prng_ctr_block(const xxh64prng_ctr_t *const ctr, const uint64_t index, void *const out)
+{
+    xxh64prng_ctr_words(ctr, index, out, XXH64PRNG_OUTPUT_WORDS);
+}
+
+/* Set the position of the next byte to be generated, in O(1) time */
+XXH64PRNG_API void xxh64prng_ctr_seek(xxh64prng_ctr_t *const ctr, const uint64_t offset)
+{
+    ctr->counter = offset / XXH64PRNG_OUTPUT_BYTES;
+    ctr->offset = XXH64PRNG_OUTPUT_BYTES;
+
+    if (offset % XXH64PRNG_OUTPUT_BYTES) {
+        xxh64prng_ctr_block(ctr, ctr->counter++, ctr->block);
+        ctr->offset = (size_t)(offset % XXH64PRNG_OUTPUT_BYTES);
+    }
+}
+
+/* Fill buffer of arbitrary size and alignment with random bytes */
+XXH64PRNG_API void xxh64prng_ctr_fill(xxh64prng_ctr_t *const ctr, void *const buf, size_t len)
+{
+    uint8_t *out = (uint8_t*)buf;
+
+    if (ctr->offset < XXH64PRNG_OUTPUT_BYTES) {
+        const size_t avail = XXH64PRNG_OUTPUT_BYTES - ctr->offset;
+        const size_t chunk_size = (len < avail) ? len : avail;
+        memcpy(out, ((const uint8_t*)ctr->block) + ctr->offset, chunk_size);
+        ctr->offset += chunk_size;
+        out += chunk_size;
+        len -= chunk_size;
+    }
+
+    while (len >= XXH64PRNG_OUTPUT_BYTES) {
+        xxh64prng_ctr_block(ctr, ctr->counter++, out);
+        out += XXH64PRNG_OUTPUT_BYTES;
+        len -= XXH64PRNG_OUTPUT_BYTES;
+    }
+
+    if (len > 0U) {
+        xxh64prng_ctr_block(ctr, ctr->counter++, ctr->block);
+        memcpy(out, ctr->block, len);
+        ctr->offset = len;
+    }
+}
+
+/* Fill buffer like xxh64prng_ctr_fill(), but drop the remainder of the last block, so it does not need to be computed */
+XXH64PRNG_API void xxh64prng_ctr_fill_final(xxh64prng_ctr_t *const ctr, void *const buf, const size_t len)
+{
+    const size_t head = xxh64prng_whole_blocks(len, XXH64PRNG_OUTPUT_BYTES - ctr->offset);
+
+    xxh64prng_ctr_fill(ctr, buf, head);
+
+    if (len > head) {
+        xxh64prng_ctr_words(ctr, ctr->counter++, ctr->block, WORDS_FOR(len - head));
+        memcpy(((uint8_t*)buf) + head, ctr->block, len - head);
+    }
+
+    ctr->offset = XXH64PRNG_OUTPUT_BYTES;
+}
+
+/* ======================================================================== */
+/* Checkpoints                                                              */
+/* ======================================================================== */
+
+/* Layout: magic[8], version[4], flags[4], state[64], offset[8], origin[8], checksum[8] (little-endian) */
+static const uint8_t CHECKPOINT_MAGIC[8U] = { 'X', 'X', 'H', '6', '4', 'C', 'K', 'P' };
+
+#define CHECKPOINT_VERSION XXH64PRNG_CHECKPOINT_VERSION
+#define CHECKPOINT_PAYLOAD (XXH64PRNG_CHECKPOINT_BYTES - sizeof(uint64_t))
+
+/* Serialize a state, the byte offset that it belongs to and the offset where the output started, the format is versioned and checksummed */
+XXH64PRNG_API void xxh64prng_checkpoint_encode(uint8_t *const out, const xxh64prng_t *const state, const uint64_t offset, const uint64_t origin, const uint32_t flags)
+{
+    const uint32_t version = CHECKPOINT_VERSION;
+    uint64_t checksum;
+
+    memcpy(out, CHECKPOINT_MAGIC, sizeof(CHECKPOINT_MAGIC));
+    memcpy(out + 8U, &version, sizeof(uint32_t));
+    memcpy(out + 12U, &flags, sizeof(uint32_t));
+    memcpy(out + 16U, state->state, _XXH64PRNG_STATE_BYTES);
+    memcpy(out + 16U + _XXH64PRNG_STATE_BYTES, &offset, sizeof(uint64_t));
+    memcpy(out + 24U + _XXH64PRNG_STATE_BYTES, &origin, sizeof(uint64_t));
+
+    checksum = XXH64(out, CHECKPOINT_PAYLOAD, CHECKPOINT_VERSION);
+    memcpy(out + CHECKPOINT_PAYLOAD, &checksum, sizeof(uint64_t));
+}
+
+/* Deserialize a checkpoint, fails if the data is corrupted or has an unsupported version */
+XXH64PRNG_API bool xxh64prng_checkpoint_decode(const uint8_t *const data, xxh64prng_t *const state, uint64_t *const offset, uint64_t *const origin, uint32_t *const flags)
+{
+    uint32_t version, value;
+    uint64_t checksum, position, start;
+
+    memcpy(&version, data + 8U, sizeof(uint32_t));
+    memcpy(&value, data + 12U, sizeof(uint32_t));
+    memcpy(&checksum, data + CHECKPOINT_PAYLOAD, sizeof(uint64_t));
+
+    if (memcmp(data, CHECKPOINT_MAGIC, sizeof(CHECKPOINT_MAGIC)) || (version != CHECKPOINT_VERSION) || (value & (~XXH64PRNG_CHECKPOINT_COUNTER))) {
+        return false;
+    }
+
+    if (XXH64(data, CHECKPOINT_PAYLOAD, CHECKPOINT_VERSION) != checksum) {
+        return false;
+    }
+
+    /* the output can not have started after the current position */
+    memcpy(&position, data + 16U + _XXH64PRNG_STATE_BYTES, sizeof(uint64_t));
+    memcpy(&start, data + 24U + _XXH64PRNG_STATE_BYTES, sizeof(uint64_t));
+    if (start > position) {
+        return false;
+    }
+
+    memcpy(state->state, data + 16U, _XXH64PRNG_STATE_BYTES);
+    *offset = position;
+    *origin = start;
+    *flags = value;
+    return true;
+}
+
+/* Restore a stream from a checkpoint state, only the block containing "offset" is generated */
+XXH64PRNG_API void xxh64prng_stream_resume(xxh64prng_stream_t *const stream, const xxh64prng_t *const state, const uint64_t offset)
+{
+    xxh64prng_stream_init(stream, state);
+    xxh64prng_skip(stream, offset % XXH64PRNG_OUTPUT_BYTES);
+}
+
+/* ======================================================================== */
+/* Multi-buffer hashing                                                     */
+/* ======================================================================== */
+
+/* Number of buffers that are hashed together, a multiple of the kernel's vector width */
+#define MULTI_LANES 8U
+
+/*
+ * Compute XXH64 of each of the "count" buffers, the results are identical to
+ * xxh64prng_hash(). With a multi-buffer kernel, each group of buffers is hashed
+ * together, one buffer per vector lane, for as many 32-byte stripes as its
+ * shortest buffer has; the rest of each buffer is finished separately. Works
+ * best for buffers of similar size.
+ */
+XXH64PRNG_API void xxh64prng_hash_multi(const void *const *const inputs, const size_t *const lens, const size_t count, const uint64_t seed, uint64_t *const out)
+{
+    uint64_t acc[4U * MULTI_LANES];
+    const uint8_t *ptr[MULTI_LANES];
+    xxh64prng_hash_t hash;
+    size_t pos = 0U, lane, stripes, j;
+
+    /* the stripes kernel is loaded once, it may be NULL (no vector implementation) */
+    const xxh64_stripes_t kernel = xxh64prng_kernels_get()->stripes;
+
+    for (; kernel && (pos + MULTI_LANES <= count); pos += MULTI_LANES) {
+        stripes = SIZE_MAX;
+        for (lane = 0U; lane < MULTI_LANES; ++lane) {
+            ptr[lane] = (const uint8_t*)inputs[pos + lane];
+            if ((lens[pos + lane] / 32U) < stripes) {
+                stripes = lens[pos + lane] / 32U;
+            }
+        }
+
+        if (!stripes) {
+            for (lane = 0U; lane < MULTI_LANES; ++lane) {
+                out[pos + lane] = XXH64(ptr[lane], lens[pos + lane], seed);
+            }
+            continue;
+        }
+
+        xxh64prng_hash_init(&hash, seed);
+        for (j = 0U; j < 4U; ++j) {
+            for (lane = 0U; lane < MULTI_LANES; ++lane) {
+                acc[(j * MULTI_LANES) + lane] = hash.acc[j];
+            }
+        }
+
+        kernel(acc, ptr, MULTI_LANES, stripes);
+
+        for (lane = 0U; lane < MULTI_LANES; ++lane) {
+            xxh64prng_hash_init(&hash, seed);
+            for (j = 0U; j < 4U; ++j) {
+                hash.acc[j] = acc[(j * MULTI_LANES) + lane];
+            }
+            hash.total_len = stripes * 32U;
+            xxh64prng_hash_update(&hash, ptr[lane] + (stripes * 32U), lens[pos + lane] - (stripes * 32U));
+            out[pos + lane] = xxh64prng_hash_digest(&hash);
+        }
+    }
+
+    for (; pos < count; ++pos) {
+        out[pos] = XXH64(inputs[pos], lens[pos], seed);
+    }
+}
+
+/* ======================================================================== */
+/* Implementation selection                                                 */
+/* ======================================================================== */
+
+static const char *const IMPL_NAMES[] = { "auto", "scalar", "avx2", "avx512", "neon" };
+
+/* Select the output function implementation, fails if unsupported by the CPU */
+XXH64PRNG_API bool xxh64prng_set_impl(const xxh64prng_impl_t impl)
+{
+    const xxh64prng_impl_t selected = (impl == XXH64PRNG_IMPL_AUTO) ? XXH64_multiseed_detect() : impl;
+    const xxh64prng_kernels_t *table;
+
+    if (((size_t)selected) >= KERNEL_TABLES) {
+        return false;
+    }
+
+    xxh64prng_os_once(&xxh64prng_kernels_once, xxh64prng_kernels_init);
+    table = &xxh64prng_kernel_tables[selected];
+
+    if ((!table->multiseed) || (!table->multistate)) {
+        return false;
+    }
+
+    POINTER_STORE(&xxh64prng_kernels, table);
+    return true;
+}
+
+/* Get the output function implementation that is currently in use */
+XXH64PRNG_API xxh64prng_impl_t xxh64prng_get_impl(void)
+{
+    return xxh64prng_kernels_get()->impl;
+}
+
+/* Get the name of an output function implementation */
+XXH64PRNG_API const char *xxh64prng_impl_name(const xxh64prng_impl_t impl)
+{
+    return (((size_t)impl) < (sizeof(IMPL_NAMES) / sizeof(IMPL_NAMES[0]))) ? IMPL_NAMES[impl] : NULL;
+}
+
+/* ======================================================================== */
+/* Statistics                                                               */
+/* ======================================================================== */
+
+/* Enable the statistics counters, which are then incremented atomically by all threads (NULL = disable); the counters must outlive every thread that may still be generating */
+XXH64PRNG_API void xxh64prng_set_stats(xxh64prng_stats_t *const stats)
+{
+    POINTER_STORE(&xxh64prng_stats, stats);
+}
+
+/* Take a snapshot of the statistics counters, while other threads may be updating them; fails if disabled */
+XXH64PRNG_API bool xxh64prng_get_stats(xxh64prng_stats_t *const out)
+{
+    xxh64prng_stats_t *const stats = (xxh64prng_stats_t*)POINTER_LOAD(&xxh64prng_stats);
+
+    if (!stats) {
+        memset(out, 0, sizeof(xxh64prng_stats_t));
+        return false;
+    }
+
+    out->blocks = STATS_ATOMIC_LOAD(&stats->blocks);
+    out->steps = STATS_ATOMIC_LOAD(&stats->steps);
+    out->retries = STATS_ATOMIC_LOAD(&stats->retries);
+    return true;
+}
+
+/* ======================================================================== */
+/* Memory wiping policy                                                     */
+/* ======================================================================== */
+
+static const char *const WIPE_NAMES[] = { "paranoid", "destroy", "off" };
+
+/* Select the memory wiping policy, applies to all threads */
+XXH64PRNG_API bool xxh64prng_set_wipe(const xxh64prng_wipe_t policy)
+{
+    if (((size_t)policy) >= (sizeof(WIPE_NAMES) / sizeof(WIPE_NAMES[0]))) {
+        return false;
+    }
+
+    if ((xxh64prng_wipe == XXH64PRNG_WIPE_ON_DESTROY) && (policy != XXH64PRNG_WIPE_ON_DESTROY)) {
+        xxh64prng_os_scratch_wipe();
+    }
+
+    xxh64prng_wipe = policy;
+    return true;
+}
+
+/* Get the memory wiping policy that is currently in use */
+XXH64PRNG_API xxh64prng_wipe_t xxh64prng_get_wipe(void)
+{
+    return xxh64prng_wipe;
+}
+
+/* Get the name of a memory wiping policy */
+XXH64PRNG_API const char *xxh64prng_wipe_name(const xxh64prng_wipe_t policy)
+{
+    return (((size_t)policy) < (sizeof(WIPE_NAMES) / sizeof(WIPE_NAMES[0]))) ? WIPE_NAMES[policy] : NULL;
+}
+
+/* Wipe the temporaries that were retained in "wipe on destroy" mode, must not be called during generation */
+XXH64PRNG_API void xxh64prng_wipe_scratch(void)
+{
+    xxh64prng_os_scratch_wipe();
 }
@@ -0,0 +1,68 @@
+/*
+ * XXH64-PRNG
+ * Blazing fast XXH64-based secure pseudo-random number generator
+ *
+ * Copyright (c) 2025 "dEajL3kA" <Cumpoing79@web.de>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * https://www.opensource.org/licenses/bsd-license.php
+ */
+
+#ifndef _XXH64PRNG_CORE_H
+#define _XXH64PRNG_CORE_H
+
+#include <xxh64_prng.h>
+
+/* intermediate values ("temp0" and "temp1") of one output block */
+#define _XXH64PRNG_TEMP_WORDS (2U * _XXH64PRNG_STATE_WORDS)
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*
+ * The generation of an output block is split into two phases: The state chain
+ * must be advanced sequentially, but once the intermediate values of a block
+ * are known, its (much more expensive) expansion is independent of all other
+ * blocks and can be done by any thread.
+ */
+XXH64PRNG_API void xxh64prng_core_advance(xxh64prng_t *const state, uint64_t *const temp);
+XXH64PRNG_API void xxh64prng_core_expand(const uint64_t *const temp, void *const out);
+
+/* In counter mode, the intermediate values are computed from (key, index) */
+XXH64PRNG_API void xxh64prng_core_counter(const uint64_t *const key, const uint64_t index, uint64_t *const temp);
+
+#if defined(ENABLE_TEST_HOOKS) && ENABLE_TEST_HOOKS
+/* Number of times the re-hash loop of the next state iterations is forced to repeat (test builds only) */
+#if defined(XXH64PRNG_HEADER_ONLY)
+static size_t xxh64prng_test_force_retry;
+#else
+extern size_t xxh64prng_test_force_retry;
+#endif
+#endif
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /*_XXH64PRNG_CORE_H*/
@@ -0,0 +1,955 @@
+/*
+ * XXH64-PRNG
+ * Blazing fast XXH64-based secure pseudo-random number generator
+ *
+ * Copyright (c) 2025 "dEajL3kA" <Cumpoing79@web.de>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * https://www.opensource.org/licenses/bsd-license.php
+ */
+
+#include <xxh64_prng.h>
+
+#include "xxh64_simd.h"
+#include <math.h>
+
+/* values are generated (and converted in-place) in chunks of this size */
+#define DIST_CHUNK 1024U
+
+/* number of ziggurat layers */
+#define DIST_LAYERS 256U
+
+#define MASK52 ((UINT64_C(1) << 52) - 1U)
+
+/* 2^-53 and 2^-24 */
+#define SCALE_DOUBLE (1.0 / 9007199254740992.0)
+#define SCALE_FLOAT (1.0f / 16777216.0f)
+
+/* start of the tail of the normal and exponential distributions */
+#define ZIG_NOR_R 3.6541528853610088
+#define ZIG_EXP_R 7.697117470131487
+
+/* ======================================================================== */
+/* Ziggurat tables                                                          */
+/* ======================================================================== */
+
+/*
+ * Marsaglia & Tsang, "The Ziggurat Method for Generating Random Variables",
+ * with 256 layers. The tables are stored as bit patterns, so that the output
+ * does not depend on the platform's math library.
+ */
+typedef union {
+    uint64_t u;
+    double d;
+} dist_table_t;
+
+/* Normal distribution: acceptance thresholds */
+static const uint64_t ZIG_NOR_K[DIST_LAYERS] = {
+    UINT64_C(0x000EF33D8025BC39), UINT64_C(0x0000000000000000), UINT64_C(0x000C08BE98F2ACAA), UINT64_C(0x000DA354FABA4236),
+    UINT64_C(0x000E51F67EC049B5), UINT64_C(0x000EB255E9D2FA41), UINT64_C(0x000EEF4B817E221C), UINT64_C(0x000F19470AF9CC80),
+    UINT64_C(0x000F37ED61FF712F), UINT64_C(0x000F4F469560DF95), UINT64_C(0x000F61A5E41B6BE3), UINT64_C(0x000F707A75536926),
+    UINT64_C(0x000F7CB2EC281EC3), UINT64_C(0x000F86F10C6337D8), UINT64_C(0x000F8FA657830A7D), UINT64_C(0x000F9724C74DB926),
+    UINT64_C(0x000F9DA907DBE051), UINT64_C(0x000FA360F581E82E), UINT64_C(0x000FA86FDE5B3BBF), UINT64_C(0x000FACF160D34659),
+    UINT64_C(0x000FB0FB6718AC00), UINT64_C(0x000FB49F8D5368F8), UINT64_C(0x000FB7EC2366F3BD), UINT64_C(0x000FBAECE9A1DB42),
+    UINT64_C(0x000FBDAB9D0402F5), UINT64_C(0x000FC03060FF6415), UINT64_C(0x000FC28210379AAA), UINT64_C(0x000FC4A67AE254C2),
+    UINT64_C(0x000FC6A2977AE7A3), UINT64_C(0x000FC87AA928908B), UINT64_C(0x000FCA325E4BD8D4), UINT64_C(0x000FCBCCE9021DC6),
+    UINT64_C(0x000FCD4D12F834C6), UINT64_C(0x000FCEB54D8FE7E7), UINT64_C(0x000FD007BF1DC4C6), UINT64_C(0x000FD1464DD6C0BA),
+    UINT64_C(0x000FD272A8E2F060), UINT64_C(0x000FD38E4FF0C565), UINT64_C(0x000FD49A9990B0F2), UINT64_C(0x000FD598B8920BF9),
+    UINT64_C(0x000FD689C08E96BD), UINT64_C(0x000FD76EA9C8E52A), UINT64_C(0x000FD848547B0606), UINT64_C(0x000FD9178BAD29CB),
+    UINT64_C(0x000FD9DD07A7AB31), UINT64_C(0x000FDA9970105C08), UINT64_C(0x000FDB4D5DC02BB8), UINT64_C(0x000FDBF95C5BFA83),
+    UINT64_C(0x000FDC9DEBB99848), UINT64_C(0x000FDD3B8118707F), UINT64_C(0x000FDDD288342D86), UINT64_C(0x000FDE6364369D6F),
+    UINT64_C(0x000FDEEE708D4F6D), UINT64_C(0x000FDF7401A6B25E), UINT64_C(0x000FDFF46599EB80), UINT64_C(0x000FE06FE4BC2343),
+    UINT64_C(0x000FE0E6C225A0B8), UINT64_C(0x000FE1593C28B6BA), UINT64_C(0x000FE1C78CBC3E15), UINT64_C(0x000FE231E9DB1B32),
+    UINT64_C(0x000FE29885DA1A27), UINT64_C(0x000FE2FB8FB54027), UINT64_C(0x000FE35B33558BF6), UINT64_C(0x000FE3B799CFFEE1),
+    UINT64_C(0x000FE410E99EAC3F), UINT64_C(0x000FE46746D475FF), UINT64_C(0x000FE4BAD34C082F), UINT64_C(0x000FE50BAED29401),
+    UINT64_C(0x000FE559F74EBB5C), UINT64_C(0x000FE5A5C8E410FF), UINT64_C(0x000FE5EF3E13857D), UINT64_C(0x000FE6366FD90F74),
+    UINT64_C(0x000FE67B75C6D47C), UINT64_C(0x000FE6BE661E10B4), UINT64_C(0x000FE6FF55E5F402), UINT64_C(0x000FE73E5900A617),
+    UINT64_C(0x000FE77B823E9D56), UINT64_C(0x000FE7B6E3706FC3), UINT64_C(0x000FE7F08D77416B), UINT64_C(0x000FE8289053EFB9),
+    UINT64_C(0x000FE85EFB35166D), UINT64_C(0x000FE893DC84079B), UINT64_C(0x000FE8C741F0CDF7), UINT64_C(0x000FE8F9387D4E36),
+    UINT64_C(0x000FE929CC879A62), UINT64_C(0x000FE95909D38833), UINT64_C(0x000FE986FB9399EE), UINT64_C(0x000FE9B3AC7147B7),
+    UINT64_C(0x000FE9DF2694B62A), UINT64_C(0x000FEA0973ABE5D4), UINT64_C(0x000FEA329CF16600), UINT64_C(0x000FEA5AAB32948C),
+    UINT64_C(0x000FEA81A6D5737C), UINT64_C(0x000FEAA797DE1C56), UINT64_C(0x000FEACC85F3D889), UINT64_C(0x000FEAF07865E5A9),
+    UINT64_C(0x000FEB13762FEB82), UINT64_C(0x000FEB3585FE29BD), UINT64_C(0x000FEB56AE316229), UINT64_C(0x000FEB76F4E28470),
+    UINT64_C(0x000FEB965FE61F8D), UINT64_C(0x000FEBB4F4CF9CF9), UINT64_C(0x000FEBD2B8F4494F), UINT64_C(0x000FEBEFB16E2DBF),
+    UINT64_C(0x000FEC0BE31EBD6C), UINT64_C(0x000FEC2752B1599A), UINT64_C(0x000FEC42049DAF5B), UINT64_C(0x000FEC5BFD29F121),
+    UINT64_C(0x000FEC75406CEE81), UINT64_C(0x000FEC8DD2500C42), UINT64_C(0x000FECA5B6911EA1), UINT64_C(0x000FECBCF0C42790),
+    UINT64_C(0x000FECD38454FAA9), UINT64_C(0x000FECE97488C84A), UINT64_C(0x000FECFEC47F914F), UINT64_C(0x000FED13773584C1),
+    UINT64_C(0x000FED278F84489E), UINT64_C(0x000FED3B10242EE8), UINT64_C(0x000FED4DFBAD580B), UINT64_C(0x000FED605498C37C),
+    UINT64_C(0x000FED721D414F89), UINT64_C(0x000FED8357E4A924), UINT64_C(0x000FED9406A42C6D), UINT64_C(0x000FEDA42B85B6A9),
+    UINT64_C(0x000FEDB3C8746A5A), UINT64_C(0x000FEDC2DF4165FA), UINT64_C(0x000FEDD171A46DFC), UINT64_C(0x000FEDDF813C8A7D),
+    UINT64_C(0x000FEDED0F90992C), UINT64_C(0x000FEDFA1E0FD3C1), UINT64_C(0x000FEE06AE124B73), UINT64_C(0x000FEE12C0D959B5),
+    UINT64_C(0x000FEE1E57900690), UINT64_C(0x000FEE29734B64D6), UINT64_C(0x000FEE34150AE46F), UINT64_C(0x000FEE3E3DB89AF0),
+    UINT64_C(0x000FEE47EE2982A8), UINT64_C(0x000FEE51271DB03C), UINT64_C(0x000FEE59E9407EF7), UINT64_C(0x000FEE623528B3E5),
+    UINT64_C(0x000FEE6A0B5897A9), UINT64_C(0x000FEE716C3E0733), UINT64_C(0x000FEE7858327B3B), UINT64_C(0x000FEE7ECF7B0674),
+    UINT64_C(0x000FEE84D2484A6E), UINT64_C(0x000FEE8A60B662FF), UINT64_C(0x000FEE8F7ACCC80F), UINT64_C(0x000FEE94207E2598),
+    UINT64_C(0x000FEE9851A829AA), UINT64_C(0x000FEE9C0E13481A), UINT64_C(0x000FEE9F557273B4), UINT64_C(0x000FEEA22762CC70),
+    UINT64_C(0x000FEEA4836B426D), UINT64_C(0x000FEEA668FC2D34), UINT64_C(0x000FEEA7D76ED6BD), UINT64_C(0x000FEEA8CE04F9CE),
+    UINT64_C(0x000FEEA94BE83300), UINT64_C(0x000FEEA9502963D4), UINT64_C(0x000FEEA8D9C00723), UINT64_C(0x000FEEA7E789761A),
+    UINT64_C(0x000FEEA678481CEC), UINT64_C(0x000FEEA48AA29E4A), UINT64_C(0x000FEEA21D22E4A2), UINT64_C(0x000FEE9F2E351FED),
+    UINT64_C(0x000FEE9BBC26AEF8), UINT64_C(0x000FEE97C524F2AD), UINT64_C(0x000FEE93473C0A03), UINT64_C(0x000FEE8E405574E0),
+    UINT64_C(0x000FEE88AE369C44), UINT64_C(0x000FEE828E7F3DC9), UINT64_C(0x000FEE7BDEA7B854), UINT64_C(0x000FEE749BFF37CB),
+    UINT64_C(0x000FEE6CC3A9BD2C), UINT64_C(0x000FEE64529E004D), UINT64_C(0x000FEE5B45A32857), UINT64_C(0x000FEE51994E5785),
+    UINT64_C(0x000FEE474A00069E), UINT64_C(0x000FEE3C53E12C1E), UINT64_C(0x000FEE30B2E02AA7), UINT64_C(0x000FEE2462AD81D4),
+    UINT64_C(0x000FEE175EB83C2A), UINT64_C(0x000FEE09A22A1417), UINT64_C(0x000FEDFB27E3499C), UINT64_C(0x000FEDEBEA76213E),
+    UINT64_C(0x000FEDDBE422044F), UINT64_C(0x000FEDCB0ECE39A5), UINT64_C(0x000FEDB964042CC6), UINT64_C(0x000FEDA6DCE9389C),
+    UINT64_C(0x000FED937237E95F), UINT64_C(0x000FED7F1C38A80A), UINT64_C(0x000FED69D2B9BFFE), UINT64_C(0x000FED538D06ADD3),
+    UINT64_C(0x000FED3C41DEA3F7), UINT64_C(0x000FED23E76A2FAC), UINT64_C(0x000FED0A732FE617), UINT64_C(0x000FECEFDA07FE08),
+    UINT64_C(0x000FECD4100EB78C), UINT64_C(0x000FECB708956E89), UINT64_C(0x000FEC98B6123096), UINT64_C(0x000FEC790A0DA94E),
+    UINT64_C(0x000FEC57F50F31D4), UINT64_C(0x000FEC356686C938), UINT64_C(0x000FEC114CB4B30B), UINT64_C(0x000FEBEB948E6FA7),
+    UINT64_C(0x000FEBC429A0B668), UINT64_C(0x000FEB9AF5EE0CB3), UINT64_C(0x000FEB6FE1C98519), UINT64_C(0x000FEB42D3AD1F75),
+    UINT64_C(0x000FEB13B00B2D23), UINT64_C(0x000FEAE2591A02C0), UINT64_C(0x000FEAAEAE99222D), UINT64_C(0x000FEA788D8EE2FE),
+    UINT64_C(0x000FEA3FCFFD73BC), UINT64_C(0x000FEA044C8DD9CE), UINT64_C(0x000FE9C5D62F5612), UINT64_C(0x000FE9843BA9477A),
+    UINT64_C(0x000FE93F471D4700), UINT64_C(0x000FE8F6BD76C5AD), UINT64_C(0x000FE8AA5DC4E8BD), UINT64_C(0x000FE859E07AB1C1),
+    UINT64_C(0x000FE804F690A917), UINT64_C(0x000FE7AB48823396), UINT64_C(0x000FE74C751F6A7C), UINT64_C(0x000FE6E8102AA1D9),
+    UINT64_C(0x000FE67DA0B6ABAF), UINT64_C(0x000FE60C9F383055), UINT64_C(0x000FE5947338F718), UINT64_C(0x000FE51470977256),
+    UINT64_C(0x000FE48BD436F42D), UINT64_C(0x000FE3F9BFFD1E0D), UINT64_C(0x000FE35D35EEB171), UINT64_C(0x000FE2B5122FE4D2),
+    UINT64_C(0x000FE2000399552B), UINT64_C(0x000FE13C827882E8), UINT64_C(0x000FE068C4EE6783), UINT64_C(0x000FDF82B02B717D),
+    UINT64_C(0x000FDE87C57EFE7C), UINT64_C(0x000FDD7509C63BCE), UINT64_C(0x000FDC46E529BEE3), UINT64_C(0x000FDAF8F82E0252),
+    UINT64_C(0x000FD985E1B2BA43), UINT64_C(0x000FD7E6EF48CED0), UINT64_C(0x000FD613ADBD64D6), UINT64_C(0x000FD40149E2EFDA),
+    UINT64_C(0x000FD1A1A7B4C772), UINT64_C(0x000FCEE204761F61), UINT64_C(0x000FCBA8D85E1171), UINT64_C(0x000FC7D26ECD2CDE),
+    UINT64_C(0x000FC32B2F1E22A1), UINT64_C(0x000FBD6581C0B7E7), UINT64_C(0x000FB606C40053D6), UINT64_C(0x000FAC40582A2805),
+    UINT64_C(0x000F9E971E014510), UINT64_C(0x000F89FA48A41D49), UINT64_C(0x000F66C5F7F02F1A), UINT64_C(0x000F1A5A4B331A0A)
+};
+
+/* Normal distribution: layer widths, scaled by 2^-52 */
+static const dist_table_t ZIG_NOR_W[DIST_LAYERS] = {
+    { UINT64_C(0x3CCF493B78164498) }, { UINT64_C(0x3C8B8D0BE3D69918) }, { UINT64_C(0x3C9250AF3C200A69) }, { UINT64_C(0x3C957CB9383AE550) },
+    { UINT64_C(0x3C9801FCE827FAC5) }, { UINT64_C(0x3C9A230C2E46389E) }, { UINT64_C(0x3C9C004D2F328D93) }, { UINT64_C(0x3C9DAC2F5A6F3120) },
+    { UINT64_C(0x3C9F32482D4807A6) }, { UINT64_C(0x3CA04D32278C832E) }, { UINT64_C(0x3CA0F5053B004B4E) }, { UINT64_C(0x3CA192A6973F450A) },
+    { UINT64_C(0x3CA227A28F78456A) }, { UINT64_C(0x3CA2B52E38621B30) }, { UINT64_C(0x3CA33C3FC055E9ED) }, { UINT64_C(0x3CA3BD9EC1A11C06) },
+    { UINT64_C(0x3CA439EF8DFE170A) }, { UINT64_C(0x3CA4B1BB363C898D) }, { UINT64_C(0x3CA5257562196C1C) }, { UINT64_C(0x3CA59580A70673C9) },
+    { UINT64_C(0x3CA60231CFD82F9B) }, { UINT64_C(0x3CA66BD261A2377E) }, { UINT64_C(0x3CA6D2A291FECA73) }, { UINT64_C(0x3CA736DAD345C6B6) },
+    { UINT64_C(0x3CA798AD10B200F0) }, { UINT64_C(0x3CA7F845AD45D397) }, { UINT64_C(0x3CA855CC5341F023) }, { UINT64_C(0x3CA8B1649E7A632C) },
+    { UINT64_C(0x3CA90B2EA94DC2A8) }, { UINT64_C(0x3CA96347822B1818) }, { UINT64_C(0x3CA9B9C98E37C43B) }, { UINT64_C(0x3CAA0ECCDCA3AB98) },
+    { UINT64_C(0x3CAA62676D76D6F5) }, { UINT64_C(0x3CAAB4AD6E0F24BA) }, { UINT64_C(0x3CAB05B16D127FD5) }, { UINT64_C(0x3CAB5584874191DA) },
+    { UINT64_C(0x3CABA4368E51BB30) }, { UINT64_C(0x3CABF1D62ABEA23B) }, { UINT64_C(0x3CAC3E70F95872E0) }, { UINT64_C(0x3CAC8A13A531630B) },
+    { UINT64_C(0x3CACD4C9FE7151CA) }, { UINT64_C(0x3CAD1E9F0E7FE5F7) }, { UINT64_C(0x3CAD679D29E3510D) }, { UINT64_C(0x3CADAFCE0022EDEE) },
+    { UINT64_C(0x3CADF73AA9F0AE8D) }, { UINT64_C(0x3CAE3DEBB5D2292D) }, { UINT64_C(0x3CAE83E93379AD08) }, { UINT64_C(0x3CAEC93ABDF8C395) },
+    { UINT64_C(0x3CAF0DE784EFA595) }, { UINT64_C(0x3CAF51F654D83C88) }, { UINT64_C(0x3CAF956D9E87202B) }, { UINT64_C(0x3CAFD8537DF97991) },
+    { UINT64_C(0x3CB00D56E041DB89) }, { UINT64_C(0x3CB02E40F5393759) }, { UINT64_C(0x3CB04EEA9E164ED4) }, { UINT64_C(0x3CB06F565B7249F9) },
+    { UINT64_C(0x3CB08F8690719EFD) }, { UINT64_C(0x3CB0AF7D84BC0D06) }, { UINT64_C(0x3CB0CF3D664B796D) }, { UINT64_C(0x3CB0EEC84B15B64D) },
+    { UINT64_C(0x3CB10E203294C4BD) }, { UINT64_C(0x3CB12D470730BF74) }, { UINT64_C(0x3CB14C3E9F8E41D8) }, { UINT64_C(0x3CB16B08BFC3D191) },
+    { UINT64_C(0x3CB189A71A788C7E) }, { UINT64_C(0x3CB1A81B51EE20A3) }, { UINT64_C(0x3CB1C666F8F7DEB3) }, { UINT64_C(0x3CB1E48B93E088DC) },
+    { UINT64_C(0x3CB2028A99405610) }, { UINT64_C(0x3CB2206572C47D17) }, { UINT64_C(0x3CB23E1D7DE97A07) }, { UINT64_C(0x3CB25BB40CA92399) },
+    { UINT64_C(0x3CB2792A661D8BCD) }, { UINT64_C(0x3CB29681C7199017) }, { UINT64_C(0x3CB2B3BB62B7E880) }, { UINT64_C(0x3CB2D0D862E172A1) },
+    { UINT64_C(0x3CB2EDD9E8CB647F) }, { UINT64_C(0x3CB30AC10D6E0469) }, { UINT64_C(0x3CB3278EE1F4755F) }, { UINT64_C(0x3CB3444470261B6A) },
+    { UINT64_C(0x3CB360E2BACA1034) }, { UINT64_C(0x3CB37D6ABE05165D) }, { UINT64_C(0x3CB399DD6FB270E9) }, { UINT64_C(0x3CB3B63BBFB7FC17) },
+    { UINT64_C(0x3CB3D2869855DD80) }, { UINT64_C(0x3CB3EEBEDE721AAC) }, { UINT64_C(0x3CB40AE571E05F24) }, { UINT64_C(0x3CB426FB2DA63591) },
+    { UINT64_C(0x3CB44300E83BF25A) }, { UINT64_C(0x3CB45EF773CA8993) }, { UINT64_C(0x3CB47ADF9E6685EA) }, { UINT64_C(0x3CB496BA3248525E) },
+    { UINT64_C(0x3CB4B287F6020506) }, { UINT64_C(0x3CB4CE49ACB2D5FD) }, { UINT64_C(0x3CB4EA0016386A9C) }, { UINT64_C(0x3CB505ABEF5E1A6D) },
+    { UINT64_C(0x3CB5214DF20A50D8) }, { UINT64_C(0x3CB53CE6D56A2C3D) }, { UINT64_C(0x3CB558774E1B7925) }, { UINT64_C(0x3CB574000E552644) },
+    { UINT64_C(0x3CB58F81C60E4C4C) }, { UINT64_C(0x3CB5AAFD2323E2FB) }, { UINT64_C(0x3CB5C672D17D3B48) }, { UINT64_C(0x3CB5E1E37B2F5545) },
+    { UINT64_C(0x3CB5FD4FC89F270F) }, { UINT64_C(0x3CB618B860A2E8FF) }, { UINT64_C(0x3CB6341DE8A27A41) }, { UINT64_C(0x3CB64F8104B6F00C) },
+    { UINT64_C(0x3CB66AE257C960D3) }, { UINT64_C(0x3CB6864283B0FBF7) }, { UINT64_C(0x3CB6A1A229507DCF) }, { UINT64_C(0x3CB6BD01E8B30F36) },
+    { UINT64_C(0x3CB6D86261289F28) }, { UINT64_C(0x3CB6F3C43161C483) }, { UINT64_C(0x3CB70F27F78B3573) }, { UINT64_C(0x3CB72A8E5168E1A6) },
+    { UINT64_C(0x3CB745F7DC70BC13) }, { UINT64_C(0x3CB7616535E540AD) }, { UINT64_C(0x3CB77CD6FAEFC22D) }, { UINT64_C(0x3CB7984DC8BA8BCB) },
+    { UINT64_C(0x3CB7B3CA3C8AE294) }, { UINT64_C(0x3CB7CF4CF3DAF1D9) }, { UINT64_C(0x3CB7EAD68C73AE15) }, { UINT64_C(0x3CB80667A486B99E) },
+    { UINT64_C(0x3CB82200DAC85645) }, { UINT64_C(0x3CB83DA2CE896F32) }, { UINT64_C(0x3CB8594E1FD1C628) }, { UINT64_C(0x3CB875036F7A4F7E) },
+    { UINT64_C(0x3CB890C35F47C831) }, { UINT64_C(0x3CB8AC8E92059192) }, { UINT64_C(0x3CB8C865ABA0DE35) }, { UINT64_C(0x3CB8E44951443C0A) },
+    { UINT64_C(0x3CB9003A297387BC) }, { UINT64_C(0x3CB91C38DC2855BC) }, { UINT64_C(0x3CB9384612EEDDB8) }, { UINT64_C(0x3CB954627903758C) },
+    { UINT64_C(0x3CB9708EBB70A936) }, { UINT64_C(0x3CB98CCB892DFDBF) }, { UINT64_C(0x3CB9A919933F6D92) }, { UINT64_C(0x3CB9C5798CD5AD43) },
+    { UINT64_C(0x3CB9E1EC2B6F486D) }, { UINT64_C(0x3CB9FE7226FAA6EA) }, { UINT64_C(0x3CBA1B0C39F90B75) }, { UINT64_C(0x3CBA37BB21A29D81) },
+    { UINT64_C(0x3CBA547F9E0B90EF) }, { UINT64_C(0x3CBA715A724A7F4D) }, { UINT64_C(0x3CBA8E4C64A00726) }, { UINT64_C(0x3CBAAB563E9FC731) },
+    { UINT64_C(0x3CBAC878CD5ACC36) }, { UINT64_C(0x3CBAE5B4E18B89DE) }, { UINT64_C(0x3CBB030B4FC37800) }, { UINT64_C(0x3CBB207CF09A6F7E) },
+    { UINT64_C(0x3CBB3E0AA0DFE361) }, { UINT64_C(0x3CBB5BB541CE14A1) }, { UINT64_C(0x3CBB797DB93F6101) }, { UINT64_C(0x3CBB9764F1E5CF51) },
+    { UINT64_C(0x3CBBB56BDB84FDBE) }, { UINT64_C(0x3CBBD3936B2E992E) }, { UINT64_C(0x3CBBF1DC9B81874A) }, { UINT64_C(0x3CBC10486CEBEFA2) },
+    { UINT64_C(0x3CBC2ED7E5F05369) }, { UINT64_C(0x3CBC4D8C136DE693) }, { UINT64_C(0x3CBC6C6608EC60B5) }, { UINT64_C(0x3CBC8B66E0EB8000) },
+    { UINT64_C(0x3CBCAA8FBD367CCD) }, { UINT64_C(0x3CBCC9E1C73BB0EA) }, { UINT64_C(0x3CBCE95E3068BACA) }, { UINT64_C(0x3CBD0906328B6A39) },
+    { UINT64_C(0x3CBD28DB1037CA23) }, { UINT64_C(0x3CBD48DE1533A181) }, { UINT64_C(0x3CBD691096E7CC94) }, { UINT64_C(0x3CBD8973F4D7D74D) },
+    { UINT64_C(0x3CBDAA0999204A4D) }, { UINT64_C(0x3CBDCAD2F8FC2520) }, { UINT64_C(0x3CBDEBD195520A7E) }, { UINT64_C(0x3CBE0D06FB49AE98) },
+    { UINT64_C(0x3CBE2E74C4EA23A7) }, { UINT64_C(0x3CBE501C99C1AE6F) }, { UINT64_C(0x3CBE72002F97DB41) }, { UINT64_C(0x3CBE94214B2A9C5C) },
+    { UINT64_C(0x3CBEB681C0F74C90) }, { UINT64_C(0x3CBED923761084F7) }, { UINT64_C(0x3CBEFC086101CA9B) }, { UINT64_C(0x3CBF1F328AC23146) },
+    { UINT64_C(0x3CBF42A40FB72BC7) }, { UINT64_C(0x3CBF665F20C8DFF6) }, { UINT64_C(0x3CBF8A6604897644) }, { UINT64_C(0x3CBFAEBB187101B4) },
+    { UINT64_C(0x3CBFD360D22FC6AE) }, { UINT64_C(0x3CBFF859C118D567) }, { UINT64_C(0x3CC00ED447D3903D) }, { UINT64_C(0x3CC021A8028FB929) },
+    { UINT64_C(0x3CC034A983A8F2A6) }, { UINT64_C(0x3CC047DA4E3EE5DB) }, { UINT64_C(0x3CC05B3BF6ADA3AC) }, { UINT64_C(0x3CC06ED023A716B0) },
+    { UINT64_C(0x3CC082988F631E79) }, { UINT64_C(0x3CC0969708E892D0) }, { UINT64_C(0x3CC0AACD7571B15A) }, { UINT64_C(0x3CC0BF3DD1EEC4F7) },
+    { UINT64_C(0x3CC0D3EA34AA2DF9) }, { UINT64_C(0x3CC0E8D4CF115675) }, { UINT64_C(0x3CC0FDFFEFA690B2) }, { UINT64_C(0x3CC1136E04206156) },
+    { UINT64_C(0x3CC129219BBB4E64) }, { UINT64_C(0x3CC13F1D69C3FAB5) }, { UINT64_C(0x3CC1556448601F9D) }, { UINT64_C(0x3CC16BF93B9DE06E) },
+    { UINT64_C(0x3CC182DF74D203F5) }, { UINT64_C(0x3CC19A1A564EDD5A) }, { UINT64_C(0x3CC1B1AD777F2157) }, { UINT64_C(0x3CC1C99CA9719877) },
+    { UINT64_C(0x3CC1E1EBFBE4A036) }, { UINT64_C(0x3CC1FA9FC2E2CB18) }, { UINT64_C(0x3CC213BC9D04BEB3) }, { UINT64_C(0x3CC22D477A6FC63B) },
+    { UINT64_C(0x3CC24745A4AC8E8B) }, { UINT64_C(0x3CC261BCC7764B62) }, { UINT64_C(0x3CC27CB2FAA84BCB) }, { UINT64_C(0x3CC2982ECD770131) },
+    { UINT64_C(0x3CC2B4375329FD27) }, { UINT64_C(0x3CC2D0D43196CE88) }, { UINT64_C(0x3CC2EE0DB1A96C02) }, { UINT64_C(0x3CC30BECD256A217) },
+    { UINT64_C(0x3CC32A7B5E6897E9) }, { UINT64_C(0x3CC349C405AE0606) }, { UINT64_C(0x3CC369D27A339BC1) }, { UINT64_C(0x3CC38AB3925634A9) },
+    { UINT64_C(0x3CC3AC7570AE7CB8) }, { UINT64_C(0x3CC3CF27B316F883) }, { UINT64_C(0x3CC3F2DBAA60E871) }, { UINT64_C(0x3CC417A49CB9D9F6) },
+    { UINT64_C(0x3CC43D98155452D1) }, { UINT64_C(0x3CC464CE44A72E74) }, { UINT64_C(0x3CC48D62759C383D) }, { UINT64_C(0x3CC4B7739D6B4ECC) },
+    { UINT64_C(0x3CC4E3250DCD7DCC) }, { UINT64_C(0x3CC5109F53E9A131) }, { UINT64_C(0x3CC54011523A7359) }, { UINT64_C(0x3CC571B1A94AD95A) },
+    { UINT64_C(0x3CC5A5C08B718342) }, { UINT64_C(0x3CC5DC8A243AC693) }, { UINT64_C(0x3CC61669CF86140F) }, { UINT64_C(0x3CC653CE7B0060DF) },
+    { UINT64_C(0x3CC69540BE9FDBED) }, { UINT64_C(0x3CC6DB6B8D09D896) }, { UINT64_C(0x3CC72728F05F70D7) }, { UINT64_C(0x3CC779955608FD5B) },
+    { UINT64_C(0x3CC7D42DF4D6C5C3) }, { UINT64_C(0x3CC839030529E9C6) }, { UINT64_C(0x3CC8AB0FBFAA7412) }, { UINT64_C(0x3CC92EE0946F3D1A) },
+    { UINT64_C(0x3CC9CBEE014050DF) }, { UINT64_C(0x3CCA8FDC7894718C) }, { UINT64_C(0x3CCB981F3878F995) }, { UINT64_C(0x3CCD3BB48209AD33) }
+};
+
+/* Normal distribution: density at the layer boundaries */
+static const dist_table_t ZIG_NOR_F[DIST_LAYERS] = {
+    { UINT64_C(0x3FF0000000000000) }, { UINT64_C(0x3FEF446AC97C0265) }, { UINT64_C(0x3FEEB7545B6E5A2D) }, { UINT64_C(0x3FEE3F11E0296BB2) },
+    { UINT64_C(0x3FEDD36FA70635F9) }, { UINT64_C(0x3FED70920658FA12) }, { UINT64_C(0x3FED144978A24289) }, { UINT64_C(0x3FECBD33A8A84602) },
+    { UINT64_C(0x3FEC6A5ECEAA82B8) }, { UINT64_C(0x3FEC1B1CD9EFB947) }, { UINT64_C(0x3FEBCEEB4EE2D08D) }, { UINT64_C(0x3FEB85653A90E040) },
+    { UINT64_C(0x3FEB3E3A8235BFDA) }, { UINT64_C(0x3FEAF92A3F6DC413) }, { UINT64_C(0x3FEAB5FEF17AF9C6) }, { UINT64_C(0x3FEA748BD5519883) },
+    { UINT64_C(0x3FEA34AAFDF6780C) }, { UINT64_C(0x3FE9F63BEE65E399) }, { UINT64_C(0x3FE9B9228D24C563) }, { UINT64_C(0x3FE97D4657623514) },
+    { UINT64_C(0x3FE94291C21C3052) }, { UINT64_C(0x3FE908F1BD322352) }, { UINT64_C(0x3FE8D0554FE6B8DC) }, { UINT64_C(0x3FE898AD48BB899A) },
+    { UINT64_C(0x3FE861EBFC3863D6) }, { UINT64_C(0x3FE82C050F577355) }, { UINT64_C(0x3FE7F6ED4B218395) }, { UINT64_C(0x3FE7C29A779D0627) },
+    { UINT64_C(0x3FE78F033CA14BC9) }, { UINT64_C(0x3FE75C1F0771708D) }, { UINT64_C(0x3FE729E5F44002A7) }, { UINT64_C(0x3FE6F850BAEB0DFB) },
+    { UINT64_C(0x3FE6C7589E63EB25) }, { UINT64_C(0x3FE696F75E51C96B) }, { UINT64_C(0x3FE667272A936F1E) }, { UINT64_C(0x3FE637E2985595DF) },
+    { UINT64_C(0x3FE609249880AE0A) }, { UINT64_C(0x3FE5DAE86F4B84FE) }, { UINT64_C(0x3FE5AD29ACC8E01C) }, { UINT64_C(0x3FE57FE4264D0F30) },
+    { UINT64_C(0x3FE55313F08E1E03) }, { UINT64_C(0x3FE526B55A65EABB) }, { UINT64_C(0x3FE4FAC4E8213283) }, { UINT64_C(0x3FE4CF3F4F49C91E) },
+    { UINT64_C(0x3FE4A42172DCCB23) }, { UINT64_C(0x3FE479685FDFC714) }, { UINT64_C(0x3FE44F114A49ABDD) }, { UINT64_C(0x3FE425198A35D3B3) },
+    { UINT64_C(0x3FE3FB7E9958CDC7) }, { UINT64_C(0x3FE3D23E10AFA266) }, { UINT64_C(0x3FE3A955A6633C57) }, { UINT64_C(0x3FE380C32BDA6EAD) },
+    { UINT64_C(0x3FE358848BF5BD57) }, { UINT64_C(0x3FE33097C970A541) }, { UINT64_C(0x3FE308FAFD64A29F) }, { UINT64_C(0x3FE2E1AC55EAA449) },
+    { UINT64_C(0x3FE2BAAA14D7FC57) }, { UINT64_C(0x3FE293F28E9432DB) }, { UINT64_C(0x3FE26D8429056971) }, { UINT64_C(0x3FE2475D5A913ECC) },
+    { UINT64_C(0x3FE2217CA9305A04) }, { UINT64_C(0x3FE1FBE0A992F702) }, { UINT64_C(0x3FE1D687FE54F920) }, { UINT64_C(0x3FE1B17157402FA1) },
+    { UINT64_C(0x3FE18C9B709B99BD) }, { UINT64_C(0x3FE168051286962A) }, { UINT64_C(0x3FE143AD105F04D3) }, { UINT64_C(0x3FE11F924831795C) },
+    { UINT64_C(0x3FE0FBB3A232B228) }, { UINT64_C(0x3FE0D81010419AAA) }, { UINT64_C(0x3FE0B4A68D7130B1) }, { UINT64_C(0x3FE091761D99B381) },
+    { UINT64_C(0x3FE06E7DCCF09138) }, { UINT64_C(0x3FE04BBCAFA69335) }, { UINT64_C(0x3FE02931E18BD539) }, { UINT64_C(0x3FE006DC85B91CDE) },
+    { UINT64_C(0x3FDFC9778C7C5FF1) }, { UINT64_C(0x3FDF859DA7A9A13D) }, { UINT64_C(0x3FDF4229CB301990) }, { UINT64_C(0x3FDEFF1A717F2C62) },
+    { UINT64_C(0x3FDEBC6E20BDBA59) }, { UINT64_C(0x3FDE7A236A4F5D07) }, { UINT64_C(0x3FDE3838EA603307) }, { UINT64_C(0x3FDDF6AD4776CFD2) },
+    { UINT64_C(0x3FDDB57F320BEAC8) }, { UINT64_C(0x3FDD74AD6427709C) }, { UINT64_C(0x3FDD3436A102A142) }, { UINT64_C(0x3FDCF419B4AEEA8E) },
+    { UINT64_C(0x3FDCB45573C135CB) }, { UINT64_C(0x3FDC74E8BB0163B2) }, { UINT64_C(0x3FDC35D26F1DB70F) }, { UINT64_C(0x3FDBF7117C61F2DE) },
+    { UINT64_C(0x3FDBB8A4D671F4CD) }, { UINT64_C(0x3FDB7A8B780798D0) }, { UINT64_C(0x3FDB3CC462B3B5FC) }, { UINT64_C(0x3FDAFF4E9EA20806) },
+    { UINT64_C(0x3FDAC2293A5FDBD7) }, { UINT64_C(0x3FDA85534AA55844) }, { UINT64_C(0x3FDA48CBEA213E9E) }, { UINT64_C(0x3FDA0C923947011E) },
+    { UINT64_C(0x3FD9D0A55E1F0F53) }, { UINT64_C(0x3FD9950484193AD3) }, { UINT64_C(0x3FD959AEDBE1183B) }, { UINT64_C(0x3FD91EA39B344260) },
+    { UINT64_C(0x3FD8E3E1FCBA6703) }, { UINT64_C(0x3FD8A9693FDF061C) }, { UINT64_C(0x3FD86F38A8ACCDF4) }, { UINT64_C(0x3FD8354F7FAA7FC5) },
+    { UINT64_C(0x3FD7FBAD11B949AD) }, { UINT64_C(0x3FD7C250AFF48400) }, { UINT64_C(0x3FD78939AF92C0F3) }, { UINT64_C(0x3FD7506769C81EAF) },
+    { UINT64_C(0x3FD717D93BA9CCCD) }, { UINT64_C(0x3FD6DF8E8612B6EC) }, { UINT64_C(0x3FD6A786AD894727) }, { UINT64_C(0x3FD66FC11A2633AF) },
+    { UINT64_C(0x3FD6383D377C4BAB) }, { UINT64_C(0x3FD600FA74813828) }, { UINT64_C(0x3FD5C9F843772671) }, { UINT64_C(0x3FD5933619D751BC) },
+    { UINT64_C(0x3FD55CB3703D62D1) }, { UINT64_C(0x3FD5266FC2539C94) }, { UINT64_C(0x3FD4F06A8EBFCD13) }, { UINT64_C(0x3FD4BAA35710FAFE) },
+    { UINT64_C(0x3FD485199FADC80D) }, { UINT64_C(0x3FD44FCCEFC38117) }, { UINT64_C(0x3FD41ABCD135D515) }, { UINT64_C(0x3FD3E5E8D08F2CBB) },
+    { UINT64_C(0x3FD3B1507CF19C77) }, { UINT64_C(0x3FD37CF368086B2C) }, { UINT64_C(0x3FD348D125FA283F) }, { UINT64_C(0x3FD314E94D5B4BBE) },
+    { UINT64_C(0x3FD2E13B77215BE5) }, { UINT64_C(0x3FD2ADC73E96934E) }, { UINT64_C(0x3FD27A8C414E0385) }, { UINT64_C(0x3FD2478A1F182FE8) },
+    { UINT64_C(0x3FD214C079F81CF7) }, { UINT64_C(0x3FD1E22EF618D06B) }, { UINT64_C(0x3FD1AFD539C33EA1) }, { UINT64_C(0x3FD17DB2ED54A239) },
+    { UINT64_C(0x3FD14BC7BB353AB8) }, { UINT64_C(0x3FD11A134FCF6F75) }, { UINT64_C(0x3FD0E8955987541A) }, { UINT64_C(0x3FD0B74D88B28C36) },
+    { UINT64_C(0x3FD0863B8F908B9B) }, { UINT64_C(0x3FD0555F22433149) }, { UINT64_C(0x3FD024B7F6C7BAF9) }, { UINT64_C(0x3FCFE88B89E01ED8) },
+    { UINT64_C(0x3FCF88108CB8BB6B) }, { UINT64_C(0x3FCF27FE6CEA202A) }, { UINT64_C(0x3FCEC854A4CA21C2) }, { UINT64_C(0x3FCE6912B228C089) },
+    { UINT64_C(0x3FCE0A381645F35F) }, { UINT64_C(0x3FCDABC455C81015) }, { UINT64_C(0x3FCD4DB6F8B2CF92) }, { UINT64_C(0x3FCCF00F8A5EEC4B) },
+    { UINT64_C(0x3FCC92CD99725A10) }, { UINT64_C(0x3FCC35F0B7D91641) }, { UINT64_C(0x3FCBD9787ABE8FDE) }, { UINT64_C(0x3FCB7D647A87A72B) },
+    { UINT64_C(0x3FCB21B452CD4505) }, { UINT64_C(0x3FCAC667A2578A1B) }, { UINT64_C(0x3FCA6B7E0B1996E0) }, { UINT64_C(0x3FCA10F7322DECF1) },
+    { UINT64_C(0x3FC9B6D2BFD36B63) }, { UINT64_C(0x3FC95D105F6AE788) }, { UINT64_C(0x3FC903AFBF756425) }, { UINT64_C(0x3FC8AAB09192E973) },
+    { UINT64_C(0x3FC852128A8200B0) }, { UINT64_C(0x3FC7F9D5621FD650) }, { UINT64_C(0x3FC7A1F8D3690665) }, { UINT64_C(0x3FC74A7C9C7B1751) },
+    { UINT64_C(0x3FC6F3607E96A72F) }, { UINT64_C(0x3FC69CA43E2250E8) }, { UINT64_C(0x3FC64647A2AE4E9C) }, { UINT64_C(0x3FC5F04A76F8DF6F) },
+    { UINT64_C(0x3FC59AAC88F3775C) }, { UINT64_C(0x3FC5456DA9C8C09D) }, { UINT64_C(0x3FC4F08DADE376A4) }, { UINT64_C(0x3FC49C0C6CF6238E) },
+    { UINT64_C(0x3FC447E9C203C9B4) }, { UINT64_C(0x3FC3F4258B698410) }, { UINT64_C(0x3FC3A0BFAAE928D4) }, { UINT64_C(0x3FC34DB805B4FAFA) },
+    { UINT64_C(0x3FC2FB0E847C7863) }, { UINT64_C(0x3FC2A8C3137A53A6) }, { UINT64_C(0x3FC256D5A283A9D2) }, { UINT64_C(0x3FC20546251885E5) },
+    { UINT64_C(0x3FC1B4149275C58A) }, { UINT64_C(0x3FC16340E5A87443) }, { UINT64_C(0x3FC112CB1DA2B434) }, { UINT64_C(0x3FC0C2B33D524DD1) },
+    { UINT64_C(0x3FC072F94BB9023D) }, { UINT64_C(0x3FC0239D5406BE88) }, { UINT64_C(0x3FBFA93ECB6BA232) }, { UINT64_C(0x3FBF0BFF29528B67) },
+    { UINT64_C(0x3FBE6F7BF29B1FEA) }, { UINT64_C(0x3FBDD3B561776082) }, { UINT64_C(0x3FBD38ABB9BE0731) }, { UINT64_C(0x3FBC9E5F493BE6BD) },
+    { UINT64_C(0x3FBC04D0680B802C) }, { UINT64_C(0x3FBB6BFF78F34FB7) }, { UINT64_C(0x3FBAD3ECE9CB6128) }, { UINT64_C(0x3FBA3C9933EACAF5) },
+    { UINT64_C(0x3FB9A604DC9DC0FE) }, { UINT64_C(0x3FB9103075A50413) }, { UINT64_C(0x3FB87B1C9DBF893E) }, { UINT64_C(0x3FB7E6CA013F4E4D) },
+    { UINT64_C(0x3FB753395AAA6D7F) }, { UINT64_C(0x3FB6C06B7369A3E7) }, { UINT64_C(0x3FB62E612485A445) }, { UINT64_C(0x3FB59D1B5774BB6B) },
+    { UINT64_C(0x3FB50C9B06FA7E17) }, { UINT64_C(0x3FB47CE1401B7223) }, { UINT64_C(0x3FB3EDEF2326E83C) }, { UINT64_C(0x3FB35FC5E4D989D0) },
+    { UINT64_C(0x3FB2D266CF9B7A28) }, { UINT64_C(0x3FB245D344DD5460) }, { UINT64_C(0x3FB1BA0CBE97CE08) }, { UINT64_C(0x3FB12F14D0F259E6) },
+    { UINT64_C(0x3FB0A4ED2C15D631) }, { UINT64_C(0x3FB01B979E31226F) }, { UINT64_C(0x3FAF262C2B6CE583) }, { UINT64_C(0x3FAE16D547B2C47C) },
+    { UINT64_C(0x3FAD092EFEAE600A) }, { UINT64_C(0x3FABFD3E0F289491) }, { UINT64_C(0x3FAAF3079038C597) }, { UINT64_C(0x3FA9EA90F929B758) },
+    { UINT64_C(0x3FA8E3E02A691375) }, { UINT64_C(0x3FA7DEFB77AF80C9) }, { UINT64_C(0x3FA6DBE9B3992600) }, { UINT64_C(0x3FA5DAB23CF2FF69) },
+    { UINT64_C(0x3FA4DB5D0E1174F2) }, { UINT64_C(0x3FA3DDF2CE993869) }, { UINT64_C(0x3FA2E27CE83E3A4F) }, { UINT64_C(0x3FA1E9059F1FAC92) },
+    { UINT64_C(0x3FA0F1982E96BE0F) }, { UINT64_C(0x3F9FF881D7191A2C) }, { UINT64_C(0x3F9E121ADB82F964) }, { UINT64_C(0x3F9C301983CD6EA9) },
+    { UINT64_C(0x3F9A529F4E234A42) }, { UINT64_C(0x3F9879D1B6011823) }, { UINT64_C(0x3F96A5DAF40C0F87) }, { UINT64_C(0x3F94D6EAF2FBF966) },
+    { UINT64_C(0x3F930D388DABA032) }, { UINT64_C(0x3F91490334606B67) }, { UINT64_C(0x3F8F152A4F734696) }, { UINT64_C(0x3F8BA48D274FEBDC) },
+    { UINT64_C(0x3F8841040D8DF3CA) }, { UINT64_C(0x3F84EB96421B129F) }, { UINT64_C(0x3F81A5922995660B) }, { UINT64_C(0x3F7CE160F8ECBD47) },
+    { UINT64_C(0x3F769EA8D90CF658) }, { UINT64_C(0x3F708A1F03B0D9D6) }, { UINT64_C(0x3F655F9F43C1D644) }, { UINT64_C(0x3F54A605B6B9F70F) }
+};
+
+/* Exponential distribution: acceptance thresholds */
+static const uint64_t ZIG_EXP_K[DIST_LAYERS] = {
+    UINT64_C(0x001C521427248BD0), UINT64_C(0x0000000000000000), UINT64_C(0x00137D5BD79C2D3C), UINT64_C(0x00186EF58E3F3A72),
+    UINT64_C(0x001A9BB7320EAFDC), UINT64_C(0x001BD127F71943FA), UINT64_C(0x001C951D0F8864C5), UINT64_C(0x001D1BFE2D5C393A),
+    UINT64_C(0x001D7E5BD56B1888), UINT64_C(0x001DC934DD172C50), UINT64_C(0x001E0409DFAC9DB0), UINT64_C(0x001E337B71D47820),
+    UINT64_C(0x001E5A8B177CB792), UINT64_C(0x001E7B42096F045B), UINT64_C(0x001E970DAF08AE31), UINT64_C(0x001EAEF5B14EF093),
+    UINT64_C(0x001EC3BD07B4654C), UINT64_C(0x001ED5F6F08799C4), UINT64_C(0x001EE614AE6E567E), UINT64_C(0x001EF46ECA361CCA),
+    UINT64_C(0x001F014B76DDD49E), UINT64_C(0x001F0CE313A796B1), UINT64_C(0x001F176369F1F774), UINT64_C(0x001F20F20C45256D),
+    UINT64_C(0x001F29AE1951A871), UINT64_C(0x001F31B18FB9552F), UINT64_C(0x001F39125157C103), UINT64_C(0x001F3FE2EB6E6948),
+    UINT64_C(0x001F463332D788F6), UINT64_C(0x001F4C10BF1D3A0E), UINT64_C(0x001F51874C5C331F), UINT64_C(0x001F56A109C3ECBE),
+    UINT64_C(0x001F5B66D9099993), UINT64_C(0x001F5FE08210D08A), UINT64_C(0x001F6414DD445771), UINT64_C(0x001F6809F6859676),
+    UINT64_C(0x001F6BC52A2B02E6), UINT64_C(0x001F6F4B3D32E4F2), UINT64_C(0x001F72A07190F13A), UINT64_C(0x001F75C8974D09D4),
+    UINT64_C(0x001F78C71B045CC0), UINT64_C(0x001F7B9F12413FF4), UINT64_C(0x001F7E5346079F88), UINT64_C(0x001F80E63BE21137),
+    UINT64_C(0x001F835A3DAD9161), UINT64_C(0x001F85B16056B913), UINT64_C(0x001F87ED89B24261), UINT64_C(0x001F8A10759374FA),
+    UINT64_C(0x001F8C1BBA3D39AD), UINT64_C(0x001F8E10CC45D048), UINT64_C(0x001F8FF102013E17), UINT64_C(0x001F91BD968358E1),
+    UINT64_C(0x001F9377AC47AFD7), UINT64_C(0x001F95204F8B64DA), UINT64_C(0x001F96B878633891), UINT64_C(0x001F98410C968892),
+    UINT64_C(0x001F99BAE146BA81), UINT64_C(0x001F9B26BC697F00), UINT64_C(0x001F9C85561B717A), UINT64_C(0x001F9DD759CFD802),
+    UINT64_C(0x001F9F1D6761A1CE), UINT64_C(0x001FA058140936C1), UINT64_C(0x001FA187EB3A3339), UINT64_C(0x001FA2AD6F6BC4FD),
+    UINT64_C(0x001FA3C91ACE0683), UINT64_C(0x001FA4DB5FEE6AA3), UINT64_C(0x001FA5E4AA4D097D), UINT64_C(0x001FA6E55EE46783),
+    UINT64_C(0x001FA7DDDCA51EC5), UINT64_C(0x001FA8CE7CE6A875), UINT64_C(0x001FA9B793CE5FEF), UINT64_C(0x001FAA9970ADB856),
+    UINT64_C(0x001FAB745E588231), UINT64_C(0x001FAC48A3740585), UINT64_C(0x001FAD1682BF9FEA), UINT64_C(0x001FADDE3B5782C0),
+    UINT64_C(0x001FAEA008F21D6E), UINT64_C(0x001FAF5C2418B07F), UINT64_C(0x001FB012C25B7A15), UINT64_C(0x001FB0C41681DFF5),
+    UINT64_C(0x001FB17050B6F1FB), UINT64_C(0x001FB2179EB2963A), UINT64_C(0x001FB2BA2BDFA84B), UINT64_C(0x001FB358217F4E19),
+    UINT64_C(0x001FB3F1A6C9BE0B), UINT64_C(0x001FB486E10CACD7), UINT64_C(0x001FB517F3C793FE), UINT64_C(0x001FB5A500C5FDAA),
+    UINT64_C(0x001FB62E2837FE58), UINT64_C(0x001FB6B388C9010B), UINT64_C(0x001FB7353FB50798), UINT64_C(0x001FB7B368DC7DA9),
+    UINT64_C(0x001FB82E1ED6BA08), UINT64_C(0x001FB8A57B0347F6), UINT64_C(0x001FB919959A0F74), UINT64_C(0x001FB98A85BA7204),
+    UINT64_C(0x001FB9F861796F27), UINT64_C(0x001FBA633DEEE287), UINT64_C(0x001FBACB2F41EC17), UINT64_C(0x001FBB3048B49145),
+    UINT64_C(0x001FBB929CAEA4E1), UINT64_C(0x001FBBF23CC8029E), UINT64_C(0x001FBC4F39D22996), UINT64_C(0x001FBCA9A3E140D5),
+    UINT64_C(0x001FBD018A548FA0), UINT64_C(0x001FBD56FBDE729C), UINT64_C(0x001FBDAA068BD66B), UINT64_C(0x001FBDFAB7CB3F42),
+    UINT64_C(0x001FBE491C7364DE), UINT64_C(0x001FBE9540C9695F), UINT64_C(0x001FBEDF3086B128), UINT64_C(0x001FBF26F6DE6175),
+    UINT64_C(0x001FBF6C9E828AE3), UINT64_C(0x001FBFB031A904C4), UINT64_C(0x001FBFF1BA0FFDB1), UINT64_C(0x001FC03141024589),
+    UINT64_C(0x001FC06ECF5B54B4), UINT64_C(0x001FC0AA6D8B1428), UINT64_C(0x001FC0E42399698B), UINT64_C(0x001FC11BF9298A65),
+    UINT64_C(0x001FC151F57D1943), UINT64_C(0x001FC1861F770F4B), UINT64_C(0x001FC1B87D9E74B4), UINT64_C(0x001FC1E91620EA43),
+    UINT64_C(0x001FC217EED505DE), UINT64_C(0x001FC2450D3C8400), UINT64_C(0x001FC27076864FC3), UINT64_C(0x001FC29A2F90630E),
+    UINT64_C(0x001FC2C23CE98046), UINT64_C(0x001FC2E8A2D2C6B3), UINT64_C(0x001FC30D654122EC), UINT64_C(0x001FC33087DE9C0F),
+    UINT64_C(0x001FC3520E0B7EC8), UINT64_C(0x001FC371FADF66F8), UINT64_C(0x001FC390512A2887), UINT64_C(0x001FC3AD137497FA),
+    UINT64_C(0x001FC3C844013349), UINT64_C(0x001FC3E1E4CCAB40), UINT64_C(0x001FC3F9F78E4DA8), UINT64_C(0x001FC4107DB85061),
+    UINT64_C(0x001FC4257877FD68), UINT64_C(0x001FC438E8B5BFC7), UINT64_C(0x001FC44ACF15112A), UINT64_C(0x001FC45B2BF447E9),
+    UINT64_C(0x001FC469FF6C4504), UINT64_C(0x001FC477495001B3), UINT64_C(0x001FC483092BFBB9), UINT64_C(0x001FC48D3E457FF6),
+    UINT64_C(0x001FC495E799D21B), UINT64_C(0x001FC49D03DD30B2), UINT64_C(0x001FC4A29179B433), UINT64_C(0x001FC4A68E8E07FC),
+    UINT64_C(0x001FC4A8F8EBFB8C), UINT64_C(0x001FC4A9CE16EAA0), UINT64_C(0x001FC4A90B41FA36), UINT64_C(0x001FC4A6AD4E28A1),
+    UINT64_C(0x001FC4A2B0C82E76), UINT64_C(0x001FC49D11E62DE3), UINT64_C(0x001FC495CC852DF4), UINT64_C(0x001FC48CDC265EC1),
+    UINT64_C(0x001FC4823BEC237A), UINT64_C(0x001FC475E696DEE7), UINT64_C(0x001FC467D6817E83), UINT64_C(0x001FC458059DC038),
+    UINT64_C(0x001FC4466D702E22), UINT64_C(0x001FC433070BCB9A), UINT64_C(0x001FC41DCB0D6E0E), UINT64_C(0x001FC406B196BBF7),
+    UINT64_C(0x001FC3EDB248CB62), UINT64_C(0x001FC3D2C43E593E), UINT64_C(0x001FC3B5DE0591B5), UINT64_C(0x001FC396F599614D),
+    UINT64_C(0x001FC376005A4594), UINT64_C(0x001FC352F3069372), UINT64_C(0x001FC32DC1B22819), UINT64_C(0x001FC3065FBD7888),
+    UINT64_C(0x001FC2DCBFCBF262), UINT64_C(0x001FC2B0D3B99F9E), UINT64_C(0x001FC2828C8FFCF1), UINT64_C(0x001FC251DA79F164),
+    UINT64_C(0x001FC21EACB6D39E), UINT64_C(0x001FC1E8F18C6757), UINT64_C(0x001FC1B09637BB3D), UINT64_C(0x001FC17586DCCD0F),
+    UINT64_C(0x001FC137AE74D6B8), UINT64_C(0x001FC0F6F6BB2415), UINT64_C(0x001FC0B348184DA5), UINT64_C(0x001FC06C898BAFF1),
+    UINT64_C(0x001FC022A092F365), UINT64_C(0x001FBFD5710F72B8), UINT64_C(0x001FBF84DD29488E), UINT64_C(0x001FBF30C52FC60B),
+    UINT64_C(0x001FBED907770CC7), UINT64_C(0x001FBE7D80327DDC), UINT64_C(0x001FBE1E094BA615), UINT64_C(0x001FBDBA7A354407),
+    UINT64_C(0x001FBD52A7B9F827), UINT64_C(0x001FBCE663C6201B), UINT64_C(0x001FBC757D2C4DE5), UINT64_C(0x001FBBFFBF63B7AA),
+    UINT64_C(0x001FBB84F23FE6A2), UINT64_C(0x001FBB04D9A0D18E), UINT64_C(0x001FBA7F351A70AC), UINT64_C(0x001FB9F3BF92B619),
+    UINT64_C(0x001FB9622ED4ABFB), UINT64_C(0x001FB8CA33174A17), UINT64_C(0x001FB82B76765B54), UINT64_C(0x001FB7859C5B895C),
+    UINT64_C(0x001FB6D840D55594), UINT64_C(0x001FB622F7D96943), UINT64_C(0x001FB5654C6F37E1), UINT64_C(0x001FB49EBFBF69D2),
+    UINT64_C(0x001FB3CEC803E747), UINT64_C(0x001FB2F4CF539C3F), UINT64_C(0x001FB21032442853), UINT64_C(0x001FB1203E5A9604),
+    UINT64_C(0x001FB0243042E1C2), UINT64_C(0x001FAF1B31C479A6), UINT64_C(0x001FAE045767E105), UINT64_C(0x001FACDE9DBF2D74),
+    UINT64_C(0x001FABA8E640060A), UINT64_C(0x001FAA61F399FF28), UINT64_C(0x001FA908656F66A2), UINT64_C(0x001FA79AB3508D3C),
+    UINT64_C(0x001FA61726D1F213), UINT64_C(0x001FA47BD48BE9FF), UINT64_C(0x001FA2C693C5C095), UINT64_C(0x001FA0F4F47DF315),
+    UINT64_C(0x001F9F04336BBE0A), UINT64_C(0x001F9CF12B79F9BD), UINT64_C(0x001F9AB84415ABC4), UINT64_C(0x001F98555B782FB8),
+    UINT64_C(0x001F95C3ABD03F78), UINT64_C(0x001F92FDA9CEF1F2), UINT64_C(0x001F8FFCDA9AE41C), UINT64_C(0x001F8CB99E7385F7),
+    UINT64_C(0x001F892AEC479605), UINT64_C(0x001F8545F904DB8D), UINT64_C(0x001F80FDC336039A), UINT64_C(0x001F7C427839E923),
+    UINT64_C(0x001F7700A3582ACB), UINT64_C(0x001F71200F1A241A), UINT64_C(0x001F6A8234B73528), UINT64_C(0x001F630000A8E263),
+    UINT64_C(0x001F5A66904FE3C0), UINT64_C(0x001F50724ECE116D), UINT64_C(0x001F44C7665C6FD5), UINT64_C(0x001F36E5A38A599B),
+    UINT64_C(0x001F261434503402), UINT64_C(0x001F113E047B0409), UINT64_C(0x001EF6AEFA57CBDA), UINT64_C(0x001ED38CA188150B),
+    UINT64_C(0x001EA2A61E122D97), UINT64_C(0x001E5961C78B2652), UINT64_C(0x001DDDF62BAC0B64), UINT64_C(0x001CDB4DD9E4E805)
+};
+
+/* Exponential distribution: layer widths, scaled by 2^-53 */
+static const dist_table_t ZIG_EXP_W[DIST_LAYERS] = {
+    { UINT64_C(0x3CD164EC94BF6631) }, { UINT64_C(0x3C60589D8B5D3A98) }, { UINT64_C(0x3C6AD6B2495B485D) }, { UINT64_C(0x3C719335A95B8BBE) },
+    { UINT64_C(0x3C7522E6E54A28B8) }, { UINT64_C(0x3C785090FBC278F4) }, { UINT64_C(0x3C7B38D1EF79B663) }, { UINT64_C(0x3C7DECD8B76DBC47) },
+    { UINT64_C(0x3C803BF049C65B9D) }, { UINT64_C(0x3C8170DB24D6F5D9) }, { UINT64_C(0x3C82980290DA25A2) }, { UINT64_C(0x3C83B388FE3D6E40) },
+    { UINT64_C(0x3C84C515C60BFD9C) }, { UINT64_C(0x3C85CDF89D024A44) }, { UINT64_C(0x3C86CF40F0A72B42) }, { UINT64_C(0x3C87C9CDDA17CFA2) },
+    { UINT64_C(0x3C88BE5954D35FFC) }, { UINT64_C(0x3C89AD8055223764) }, { UINT64_C(0x3C8A97C8BE5D519B) }, { UINT64_C(0x3C8B7DA5DDDDA35D) },
+    { UINT64_C(0x3C8C5F7BD78C3F25) }, { UINT64_C(0x3C8D3DA24DF17BD4) }, { UINT64_C(0x3C8E186678F172FC) }, { UINT64_C(0x3C8EF00CCF5F4F4E) },
+    { UINT64_C(0x3C8FC4D25D6831AE) }, { UINT64_C(0x3C904B76ED6A752B) }, { UINT64_C(0x3C90B348479B80D0) }, { UINT64_C(0x3C9119F38749F584) },
+    { UINT64_C(0x3C917F8CEB4BDF77) }, { UINT64_C(0x3C91E426E93E49BE) }, { UINT64_C(0x3C9247D26538FF07) }, { UINT64_C(0x3C92AA9EE12367E4) },
+    { UINT64_C(0x3C930C9AA526DA26) }, { UINT64_C(0x3C936DD2E26D81DE) }, { UINT64_C(0x3C93CE53D121627C) }, { UINT64_C(0x3C942E28CA706726) },
+    { UINT64_C(0x3C948D5C5F35E6F0) }, { UINT64_C(0x3C94EBF86BCD0B72) }, { UINT64_C(0x3C954A0629786F2B) }, { UINT64_C(0x3C95A78E3DB8BEDD) },
+    { UINT64_C(0x3C960498C7DD2EAF) }, { UINT64_C(0x3C96612D6D0C68C1) }, { UINT64_C(0x3C96BD5362FAA926) }, { UINT64_C(0x3C9719117979909E) },
+    { UINT64_C(0x3C97746E23077956) }, { UINT64_C(0x3C97CF6F7C7E8155) }, { UINT64_C(0x3C982A1B53FED57D) }, { UINT64_C(0x3C9884772F2BE1D0) },
+    { UINT64_C(0x3C98DE8850D0C50E) }, { UINT64_C(0x3C993853BDFDA22A) }, { UINT64_C(0x3C9991DE42AD131E) }, { UINT64_C(0x3C99EB2C75FF03A4) },
+    { UINT64_C(0x3C9A4442BE148830) }, { UINT64_C(0x3C9A9D255396D247) }, { UINT64_C(0x3C9AF5D844F224B0) }, { UINT64_C(0x3C9B4E5F794C9782) },
+    { UINT64_C(0x3C9BA6BEB33F8F70) }, { UINT64_C(0x3C9BFEF99359FE80) }, { UINT64_C(0x3C9C57139A70D286) }, { UINT64_C(0x3C9CAF102BC25AC3) },
+    { UINT64_C(0x3C9D06F28EF0E6E3) }, { UINT64_C(0x3C9D5EBDF1D86B75) }, { UINT64_C(0x3C9DB6756A429040) }, { UINT64_C(0x3C9E0E1BF77C31E7) },
+    { UINT64_C(0x3C9E65B483CF102D) }, { UINT64_C(0x3C9EBD41E5E21B4C) }, { UINT64_C(0x3C9F14C6E202948A) }, { UINT64_C(0x3C9F6C462B57FEA0) },
+    { UINT64_C(0x3C9FC3C26504A98B) }, { UINT64_C(0x3CA00D9F119A3CCE) }, { UINT64_C(0x3CA0395DF60DB157) }, { UINT64_C(0x3CA0651F1C7276EE) },
+    { UINT64_C(0x3CA090E3BB4B0069) }, { UINT64_C(0x3CA0BCAD0371012E) }, { UINT64_C(0x3CA0E87C207A2F5D) }, { UINT64_C(0x3CA114523917AC0D) },
+    { UINT64_C(0x3CA140306F707DB5) }, { UINT64_C(0x3CA16C17E1777FF2) }, { UINT64_C(0x3CA19809A93D238C) }, { UINT64_C(0x3CA1C406DD3D5279) },
+    { UINT64_C(0x3CA1F01090A9C4D8) }, { UINT64_C(0x3CA21C27D3B10DFB) }, { UINT64_C(0x3CA2484DB3C2A320) }, { UINT64_C(0x3CA274833BD01896) },
+    { UINT64_C(0x3CA2A0C9748BCDA1) }, { UINT64_C(0x3CA2CD2164A53B55) }, { UINT64_C(0x3CA2F98C11031718) }, { UINT64_C(0x3CA3260A7CFB7609) },
+    { UINT64_C(0x3CA3529DAA8A1B99) }, { UINT64_C(0x3CA37F469A851AE8) }, { UINT64_C(0x3CA3AC064CCFEFF5) }, { UINT64_C(0x3CA3D8DDC08D3366) },
+    { UINT64_C(0x3CA405CDF44F09BD) }, { UINT64_C(0x3CA432D7E6466CC9) }, { UINT64_C(0x3CA45FFC94716CA0) }, { UINT64_C(0x3CA48D3CFCC883BD) },
+    { UINT64_C(0x3CA4BA9A1D6B189D) }, { UINT64_C(0x3CA4E814F4CB45E3) }, { UINT64_C(0x3CA515AE81D900F4) }, { UINT64_C(0x3CA54367C42CB5F1) },
+    { UINT64_C(0x3CA57141BC316F21) }, { UINT64_C(0x3CA59F3D6B4E9CF3) }, { UINT64_C(0x3CA5CD5BD411932F) }, { UINT64_C(0x3CA5FB9DFA56CF21) },
+    { UINT64_C(0x3CA62A04E3731A28) }, { UINT64_C(0x3CA65891965C9B87) }, { UINT64_C(0x3CA687451BD3EBEA) }, { UINT64_C(0x3CA6B6207E8D3CDB) },
+    { UINT64_C(0x3CA6E524CB59A604) }, { UINT64_C(0x3CA714531150A9F7) }, { UINT64_C(0x3CA743AC61FA0419) }, { UINT64_C(0x3CA77331D177D12D) },
+    { UINT64_C(0x3CA7A2E476B12408) }, { UINT64_C(0x3CA7D2C56B7D17F5) }, { UINT64_C(0x3CA802D5CCCE7275) }, { UINT64_C(0x3CA83316BADFE628) },
+    { UINT64_C(0x3CA86389596108E5) }, { UINT64_C(0x3CA8942ECFA40F52) }, { UINT64_C(0x3CA8C50848CC6092) }, { UINT64_C(0x3CA8F616F3FE1511) },
+    { UINT64_C(0x3CA9275C048E73DF) }, { UINT64_C(0x3CA958D8B2358288) }, { UINT64_C(0x3CA98A8E3940BBF2) }, { UINT64_C(0x3CA9BC7DDAC7035B) },
+    { UINT64_C(0x3CA9EEA8DCDDE950) }, { UINT64_C(0x3CAA21108AD0592C) }, { UINT64_C(0x3CAA53B63556C68E) }, { UINT64_C(0x3CAA869B32D0F30E) },
+    { UINT64_C(0x3CAAB9C0DF816579) }, { UINT64_C(0x3CAAED289DCAACFF) }, { UINT64_C(0x3CAB20D3D66E8BB6) }, { UINT64_C(0x3CAB54C3F8CF2543) },
+    { UINT64_C(0x3CAB88FA7B324FB7) }, { UINT64_C(0x3CABBD78DB072612) }, { UINT64_C(0x3CABF2409D2DFD87) }, { UINT64_C(0x3CAC27534E42E02F) },
+    { UINT64_C(0x3CAC5CB282EAB1A7) }, { UINT64_C(0x3CAC925FD82323FE) }, { UINT64_C(0x3CACC85CF395A56F) }, { UINT64_C(0x3CACFEAB83ED7183) },
+    { UINT64_C(0x3CAD354D4130F2B1) }, { UINT64_C(0x3CAD6C43ED1EA402) }, { UINT64_C(0x3CADA391538DA50E) }, { UINT64_C(0x3CADDB374AD23583) },
+    { UINT64_C(0x3CAE1337B42650A0) }, { UINT64_C(0x3CAE4B947C16A456) }, { UINT64_C(0x3CAE844F9AF42384) }, { UINT64_C(0x3CAEBD6B154A767E) },
+    { UINT64_C(0x3CAEF6E8FC5B916E) }, { UINT64_C(0x3CAF30CB6EA0BC85) }, { UINT64_C(0x3CAF6B1498515ED6) }, { UINT64_C(0x3CAFA5C6B3EFE1EC) },
+    { UINT64_C(0x3CAFE0E40ADD09E0) }, { UINT64_C(0x3CB00E377AF911D8) }, { UINT64_C(0x3CB02C34EF11391E) }, { UINT64_C(0x3CB04A6B9E9224A6) },
+    { UINT64_C(0x3CB068DCCF1126DE) }, { UINT64_C(0x3CB08789CF3AAD12) }, { UINT64_C(0x3CB0A673F733C81D) }, { UINT64_C(0x3CB0C59CA9009473) },
+    { UINT64_C(0x3CB0E50550EFCFBB) }, { UINT64_C(0x3CB104AF660BEFD2) }, { UINT64_C(0x3CB1249C6A92154E) }, { UINT64_C(0x3CB144CDEC6F3A2F) },
+    { UINT64_C(0x3CB1654585C404C4) }, { UINT64_C(0x3CB18604DD6FAEA1) }, { UINT64_C(0x3CB1A70DA7A27824) }, { UINT64_C(0x3CB1C861A6782A5E) },
+    { UINT64_C(0x3CB1EA02AA9B3374) }, { UINT64_C(0x3CB20BF293F0F4A5) }, { UINT64_C(0x3CB22E33524FE553) }, { UINT64_C(0x3CB250C6E6403BBD) },
+    { UINT64_C(0x3CB273AF61C7DAA9) }, { UINT64_C(0x3CB296EEE942532E) }, { UINT64_C(0x3CB2BA87B445DB54) }, { UINT64_C(0x3CB2DE7C0E962D74) },
+    { UINT64_C(0x3CB302CE59265969) }, { UINT64_C(0x3CB327810B2AA7D5) }, { UINT64_C(0x3CB34C96B33BC96A) }, { UINT64_C(0x3CB37211F88CA85B) },
+    { UINT64_C(0x3CB397F59C345148) }, { UINT64_C(0x3CB3BE447A8D8B88) }, { UINT64_C(0x3CB3E5018CADDED4) }, { UINT64_C(0x3CB40C2FE9F5EEB2) },
+    { UINT64_C(0x3CB433D2C9BD42FD) }, { UINT64_C(0x3CB45BED851BC932) }, { UINT64_C(0x3CB4848398D39438) }, { UINT64_C(0x3CB4AD98A75DA152) },
+    { UINT64_C(0x3CB4D7307B1CB12D) }, { UINT64_C(0x3CB5014F08B9950F) }, { UINT64_C(0x3CB52BF871ACAAB9) }, { UINT64_C(0x3CB5573106F8A762) },
+    { UINT64_C(0x3CB582FD4C1B4469) }, { UINT64_C(0x3CB5AF61FA38E10F) }, { UINT64_C(0x3CB5DC640388BDA5) }, { UINT64_C(0x3CB60A0897081881) },
+    { UINT64_C(0x3CB63855247B2E9D) }, { UINT64_C(0x3CB6674F60C3F43B) }, { UINT64_C(0x3CB696FD4A9748F8) }, { UINT64_C(0x3CB6C7652F9A7B28) },
+    { UINT64_C(0x3CB6F88DB1F42511) }, { UINT64_C(0x3CB72A7DCE5CD222) }, { UINT64_C(0x3CB75D3CE2BD71CE) }, { UINT64_C(0x3CB790D2B56B7205) },
+    { UINT64_C(0x3CB7C5477D1476E0) }, { UINT64_C(0x3CB7FAA3E96E1420) }, { UINT64_C(0x3CB830F12CC0BED1) }, { UINT64_C(0x3CB8683906687350) },
+    { UINT64_C(0x3CB8A085CE695BB9) }, { UINT64_C(0x3CB8D9E2823B36A4) }, { UINT64_C(0x3CB9145AD2F37553) }, { UINT64_C(0x3CB94FFB34FC2A1E) },
+    { UINT64_C(0x3CB98CD0F18D1AE8) }, { UINT64_C(0x3CB9CAEA3A24D9FB) }, { UINT64_C(0x3CBA0A563E49F18A) }, { UINT64_C(0x3CBA4B2543E84C4E) },
+    { UINT64_C(0x3CBA8D68C2AD86FD) }, { UINT64_C(0x3CBAD13382D845D9) }, { UINT64_C(0x3CBB1699C003B61F) }, { UINT64_C(0x3CBB5DB15091EA25) },
+    { UINT64_C(0x3CBBA691D276DA75) }, { UINT64_C(0x3CBBF154DE4BEF8F) }, { UINT64_C(0x3CBC3E1641C2E0C0) }, { UINT64_C(0x3CBC8CF442C8C90E) },
+    { UINT64_C(0x3CBCDE0FECF2A99B) }, { UINT64_C(0x3CBD318D6B2738E2) }, { UINT64_C(0x3CBD87946FEC3C0A) }, { UINT64_C(0x3CBDE050AF4EF1BE) },
+    { UINT64_C(0x3CBE3BF26E190980) }, { UINT64_C(0x3CBE9AAF2AF383E2) }, { UINT64_C(0x3CBEFCC26750EA6C) }, { UINT64_C(0x3CBF626E9791F7CB) },
+    { UINT64_C(0x3CBFCBFE43F6C70C) }, { UINT64_C(0x3CC01CE2B362EC42) }, { UINT64_C(0x3CC056118BF58F04) }, { UINT64_C(0x3CC091C1CDCBA564) },
+    { UINT64_C(0x3CC0D031785D48B8) }, { UINT64_C(0x3CC111A8034392C0) }, { UINT64_C(0x3CC1567867754445) }, { UINT64_C(0x3CC19F03BCB3C2F3) },
+    { UINT64_C(0x3CC1EBBCA0C9FA9B) }, { UINT64_C(0x3CC23D2BB65991C0) }, { UINT64_C(0x3CC293F5AE49AAC9) }, { UINT64_C(0x3CC2F0E38A441217) },
+    { UINT64_C(0x3CC354EE27CCF788) }, { UINT64_C(0x3CC3C14EC7C8B890) }, { UINT64_C(0x3CC4379766E41396) }, { UINT64_C(0x3CC4B9D7CD47520C) },
+    { UINT64_C(0x3CC54AD83CCF7438) }, { UINT64_C(0x3CC5EE7AE173141F) }, { UINT64_C(0x3CC6AA676D4BBFCB) }, { UINT64_C(0x3CC78750D6EAC69A) },
+    { UINT64_C(0x3CC8939FE6F2ED9F) }, { UINT64_C(0x3CC9E9DC0D487C37) }, { UINT64_C(0x3CCBC39E51DA7303) }, { UINT64_C(0x3CCEC9D9297EBD6F) }
+};
+
+/* Exponential distribution: density at the layer boundaries */
+static const dist_table_t ZIG_EXP_F[DIST_LAYERS] = {
+    { UINT64_C(0x3FF0000000000000) }, { UINT64_C(0x3FEE0545E58811FA) }, { UINT64_C(0x3FECD0A65082007B) }, { UINT64_C(0x3FEBE5007BEB7B96) },
+    { UINT64_C(0x3FEB210F0EE67F88) }, { UINT64_C(0x3FEA76BAA562FB39) }, { UINT64_C(0x3FE9DE9715556DE4) }, { UINT64_C(0x3FE95431C455AA7C) },
+    { UINT64_C(0x3FE8D4A376D3D26D) }, { UINT64_C(0x3FE85DE87806C5F1) }, { UINT64_C(0x3FE7EE8A2D24315C) }, { UINT64_C(0x3FE7856E9B09D4B1) },
+    { UINT64_C(0x3FE721BB5BA94B93) }, { UINT64_C(0x3FE6C2C3498418F3) }, { UINT64_C(0x3FE667FA6D4F5C31) }, { UINT64_C(0x3FE610EDC1A7AF8F) },
+    { UINT64_C(0x3FE5BD3D694CAC9C) }, { UINT64_C(0x3FE56C9882DA8798) }, { UINT64_C(0x3FE51EBA157889BD) }, { UINT64_C(0x3FE4D366C151F8D0) },
+    { UINT64_C(0x3FE48A6AFB8EE089) }, { UINT64_C(0x3FE44399AFA8E144) }, { UINT64_C(0x3FE3FECB2BB18B9D) }, { UINT64_C(0x3FE3BBDC44E1D130) },
+    { UINT64_C(0x3FE37AADA708DDF5) }, { UINT64_C(0x3FE33B23450E6333) }, { UINT64_C(0x3FE2FD23E345DA78) }, { UINT64_C(0x3FE2C098B61F4F3D) },
+    { UINT64_C(0x3FE2856D111132D5) }, { UINT64_C(0x3FE24B8E228C50BA) }, { UINT64_C(0x3FE212EABA813EDF) }, { UINT64_C(0x3FE1DB7319877B9F) },
+    { UINT64_C(0x3FE1A518C71E3B3A) }, { UINT64_C(0x3FE16FCE6DCE7002) }, { UINT64_C(0x3FE13B87BC3316AF) }, { UINT64_C(0x3FE108394A1CC39F) },
+    { UINT64_C(0x3FE0D5D8812B1E3D) }, { UINT64_C(0x3FE0A45B8854D03B) }, { UINT64_C(0x3FE073B931EE3B8E) }, { UINT64_C(0x3FE043E8EBD26558) },
+    { UINT64_C(0x3FE014E2B160F334) }, { UINT64_C(0x3FDFCD3DFE214595) }, { UINT64_C(0x3FDF722D8EBFC618) }, { UINT64_C(0x3FDF1886D1EB426A) },
+    { UINT64_C(0x3FDEC03D4B969DAC) }, { UINT64_C(0x3FDE6945367DD36C) }, { UINT64_C(0x3FDE139375E13817) }, { UINT64_C(0x3FDDBF1D88A72126) },
+    { UINT64_C(0x3FDD6BD97DB9ED93) }, { UINT64_C(0x3FDD19BDE97E1A23) }, { UINT64_C(0x3FDCC8C1DC40E0AA) }, { UINT64_C(0x3FDC78DCD983FB78) },
+    { UINT64_C(0x3FDC2A06D00EA59A) }, { UINT64_C(0x3FDBDC3812AEEECC) }, { UINT64_C(0x3FDB8F6951990B9E) }, { UINT64_C(0x3FDB439394548085) },
+    { UINT64_C(0x3FDAF8B03428EF75) }, { UINT64_C(0x3FDAAEB8D6FDF6FA) }, { UINT64_C(0x3FDA65A76AA30154) }, { UINT64_C(0x3FDA1D7620752207) },
+    { UINT64_C(0x3FD9D61F695A37A5) }, { UINT64_C(0x3FD98F9DF2097BBB) }, { UINT64_C(0x3FD949EC9F9A8122) }, { UINT64_C(0x3FD905068C545D16) },
+    { UINT64_C(0x3FD8C0E704B75D4B) }, { UINT64_C(0x3FD87D8984BC3F9D) }, { UINT64_C(0x3FD83AE9B5446149) }, { UINT64_C(0x3FD7F90369B6CE69) },
+    { UINT64_C(0x3FD7B7D29DC6802E) }, { UINT64_C(0x3FD77753735E72F3) }, { UINT64_C(0x3FD7378230B08DFA) }, { UINT64_C(0x3FD6F85B3E649EAB) },
+    { UINT64_C(0x3FD6B9DB25E4E9A9) }, { UINT64_C(0x3FD67BFE8FC60DAB) }, { UINT64_C(0x3FD63EC2424827F0) }, { UINT64_C(0x3FD602231FEF5882) },
+    { UINT64_C(0x3FD5C61E2631EE78) }, { UINT64_C(0x3FD58AB06C3AA9FB) }, { UINT64_C(0x3FD54FD721BDA3F3) }, { UINT64_C(0x3FD5158F8DDE8A02) },
+    { UINT64_C(0x3FD4DBD70E26F92A) }, { UINT64_C(0x3FD4A2AB158BDADF) }, { UINT64_C(0x3FD46A092B80BEFB) }, { UINT64_C(0x3FD431EEEB1841ED) },
+    { UINT64_C(0x3FD3FA5A0230A159) }, { UINT64_C(0x3FD3C34830ABB28F) }, { UINT64_C(0x3FD38CB747B17DF9) }, { UINT64_C(0x3FD356A528FCD0E7) },
+    { UINT64_C(0x3FD3210FC631243E) }, { UINT64_C(0x3FD2EBF520394279) }, { UINT64_C(0x3FD2B75346AE226B) }, { UINT64_C(0x3FD2832857457631) },
+    { UINT64_C(0x3FD24F727D477705) }, { UINT64_C(0x3FD21C2FF10B7F07) }, { UINT64_C(0x3FD1E95EF77B09E2) }, { UINT64_C(0x3FD1B6FDE19ABC61) },
+    { UINT64_C(0x3FD1850B0C191989) }, { UINT64_C(0x3FD15384DEE291F7) }, { UINT64_C(0x3FD12269CCBA9FC2) }, { UINT64_C(0x3FD0F1B852D9A673) },
+    { UINT64_C(0x3FD0C16EF88F5339) }, { UINT64_C(0x3FD0918C4EE93E19) }, { UINT64_C(0x3FD0620EF05D90D8) }, { UINT64_C(0x3FD032F580797C32) },
+    { UINT64_C(0x3FD0043EAB934770) }, { UINT64_C(0x3FCFABD24CFF935F) }, { UINT64_C(0x3FCF4FE75C963E87) }, { UINT64_C(0x3FCEF4BA0FE8E0A4) },
+    { UINT64_C(0x3FCE9A48005940F9) }, { UINT64_C(0x3FCE408ED62F83AE) }, { UINT64_C(0x3FCDE78C48224F3E) }, { UINT64_C(0x3FCD8F3E1AE3EEBD) },
+    { UINT64_C(0x3FCD37A220B43201) }, { UINT64_C(0x3FCCE0B638F6D0A2) }, { UINT64_C(0x3FCC8A784FCE1805) }, { UINT64_C(0x3FCC34E65DB9AFF1) },
+    { UINT64_C(0x3FCBDFFE67394438) }, { UINT64_C(0x3FCB8BBE7C72E4A8) }, { UINT64_C(0x3FCB3824B8DCEF41) }, { UINT64_C(0x3FCAE52F42EB5B0F) },
+    { UINT64_C(0x3FCA92DC4BC03C4C) }, { UINT64_C(0x3FCA412A0EDF5CBF) }, { UINT64_C(0x3FC9F016D1E4C515) }, { UINT64_C(0x3FC99FA0E43E1626) },
+    { UINT64_C(0x3FC94FC69EE692A3) }, { UINT64_C(0x3FC900866425BB7B) }, { UINT64_C(0x3FC8B1DE9F5062D7) }, { UINT64_C(0x3FC863CDC48C1AFB) },
+    { UINT64_C(0x3FC816525094E7E7) }, { UINT64_C(0x3FC7C96AC8851BAF) }, { UINT64_C(0x3FC77D15B99F46FD) }, { UINT64_C(0x3FC73151B91A2838) },
+    { UINT64_C(0x3FC6E61D63EE84E9) }, { UINT64_C(0x3FC69B775EA6DA26) }, { UINT64_C(0x3FC6515E5530D1A9) }, { UINT64_C(0x3FC607D0FAB06A2E) },
+    { UINT64_C(0x3FC5BECE0954C2B2) }, { UINT64_C(0x3FC57654422E78F1) }, { UINT64_C(0x3FC52E626D078C45) }, { UINT64_C(0x3FC4E6F7583CB6F5) },
+    { UINT64_C(0x3FC4A011D8983091) }, { UINT64_C(0x3FC459B0C92DCCC1) }, { UINT64_C(0x3FC413D30B386A95) }, { UINT64_C(0x3FC3CE7785F8A900) },
+    { UINT64_C(0x3FC3899D2694D5C4) }, { UINT64_C(0x3FC34542DFFA0CAA) }, { UINT64_C(0x3FC30167AABE7D68) }, { UINT64_C(0x3FC2BE0A8504CF2D) },
+    { UINT64_C(0x3FC27B2A72609939) }, { UINT64_C(0x3FC238C67BBBE871) }, { UINT64_C(0x3FC1F6DDAF3DCA5E) }, { UINT64_C(0x3FC1B56F2031D65F) },
+    { UINT64_C(0x3FC17479E6F0AE70) }, { UINT64_C(0x3FC133FD20C97127) }, { UINT64_C(0x3FC0F3F7EFEC1719) }, { UINT64_C(0x3FC0B4697B54B629) },
+    { UINT64_C(0x3FC07550EEB7A5B8) }, { UINT64_C(0x3FC036AD7A6E7EFE) }, { UINT64_C(0x3FBFF0FCA6CBEA7F) }, { UINT64_C(0x3FBF758566190406) },
+    { UINT64_C(0x3FBEFAF3AE83C32D) }, { UINT64_C(0x3FBE8146048EB9BE) }, { UINT64_C(0x3FBE087AF561BAED) }, { UINT64_C(0x3FBD909116AD938A) },
+    { UINT64_C(0x3FBD198706914DCA) }, { UINT64_C(0x3FBCA35B6B80FD4B) }, { UINT64_C(0x3FBC2E0CF42E10A3) }, { UINT64_C(0x3FBBB99A57712681) },
+    { UINT64_C(0x3FBB46025435653B) }, { UINT64_C(0x3FBAD343B1655459) }, { UINT64_C(0x3FBA615D3DD938AC) }, { UINT64_C(0x3FB9F04DD046F41E) },
+    { UINT64_C(0x3FB9801447336B67) }, { UINT64_C(0x3FB910AF88E574B0) }, { UINT64_C(0x3FB8A21E835A5331) }, { UINT64_C(0x3FB834602C3BC4AE) },
+    { UINT64_C(0x3FB7C77380D7A6E6) }, { UINT64_C(0x3FB75B5786193C10) }, { UINT64_C(0x3FB6F00B488416A9) }, { UINT64_C(0x3FB6858DDC30B613) },
+    { UINT64_C(0x3FB61BDE5CCADEEA) }, { UINT64_C(0x3FB5B2FBED91BB32) }, { UINT64_C(0x3FB54AE5B959D02A) }, { UINT64_C(0x3FB4E39AF290D91C) },
+    { UINT64_C(0x3FB47D1AD343984F) }, { UINT64_C(0x3FB417649D25B100) }, { UINT64_C(0x3FB3B277999B9F90) }, { UINT64_C(0x3FB34E5319C6E709) },
+    { UINT64_C(0x3FB2EAF676948DC3) }, { UINT64_C(0x3FB2886110CE0561) }, { UINT64_C(0x3FB22692512C9D7B) }, { UINT64_C(0x3FB1C589A86FA32E) },
+    { UINT64_C(0x3FB165468F755381) }, { UINT64_C(0x3FB105C88756CA40) }, { UINT64_C(0x3FB0A70F19871B2C) }, { UINT64_C(0x3FB04919D7F5C806) },
+    { UINT64_C(0x3FAFD7D0BA699654) }, { UINT64_C(0x3FAF1EF49944E811) }, { UINT64_C(0x3FAE679EA52EB2C1) }, { UINT64_C(0x3FADB1CE493157EB) },
+    { UINT64_C(0x3FACFD83031E7925) }, { UINT64_C(0x3FAC4ABC640721C5) }, { UINT64_C(0x3FAB997A10BED95E) }, { UINT64_C(0x3FAAE9BBC26A805B) },
+    { UINT64_C(0x3FAA3B81471BF10D) }, { UINT64_C(0x3FA98ECA827B7C20) }, { UINT64_C(0x3FA8E3976E807742) }, { UINT64_C(0x3FA839E81C3A3940) },
+    { UINT64_C(0x3FA791BCB4AB0873) }, { UINT64_C(0x3FA6EB1579B6AF28) }, { UINT64_C(0x3FA645F2C726A017) }, { UINT64_C(0x3FA5A25513C5D29F) },
+    { UINT64_C(0x3FA5003CF296C5C1) }, { UINT64_C(0x3FA45FAB14266AED) }, { UINT64_C(0x3FA3C0A047FF18D2) }, { UINT64_C(0x3FA3231D7E3F1481) },
+    { UINT64_C(0x3FA28723C956BFDF) }, { UINT64_C(0x3FA1ECB45FF312A6) }, { UINT64_C(0x3FA153D09F19B373) }, { UINT64_C(0x3FA0BC7A0C7CD624) },
+    { UINT64_C(0x3FA026B2590DFAC0) }, { UINT64_C(0x3F9F24F6C7AF9834) }, { UINT64_C(0x3F9DFFAE7A51740B) }, { UINT64_C(0x3F9CDD9054331AAD) },
+    { UINT64_C(0x3F9BBEA150FA5810) }, { UINT64_C(0x3F9AA2E6E6924E3B) }, { UINT64_C(0x3F998A670F1329E9) }, { UINT64_C(0x3F98752853EC9909) },
+    { UINT64_C(0x3F976331DA87FC38) }, { UINT64_C(0x3F96548B72A2401B) }, { UINT64_C(0x3F95493DA6AB01F6) }, { UINT64_C(0x3F944151CE87F062) },
+    { UINT64_C(0x3F933CD225315D27) }, { UINT64_C(0x3F923BC9E1B939D5) }, { UINT64_C(0x3F913E4554725F02) }, { UINT64_C(0x3F904452091E0295) },
+    { UINT64_C(0x3F8E9BFDDE89C716) }, { UINT64_C(0x3F8CB6B9146E269F) }, { UINT64_C(0x3F8AD8FA5542C878) }, { UINT64_C(0x3F8902EA688FA706) },
+    { UINT64_C(0x3F8734B6E6AA7443) }, { UINT64_C(0x3F856E930BE4161C) }, { UINT64_C(0x3F83B0B8C1516EB2) }, { UINT64_C(0x3F81FB69EDB375C3) },
+    { UINT64_C(0x3F804EF2295FD74C) }, { UINT64_C(0x3F7D5751FA745C6D) }, { UINT64_C(0x3F7A23E9D49746E1) }, { UINT64_C(0x3F77049F37EC34CD) },
+    { UINT64_C(0x3F73FA97CEE321B2) }, { UINT64_C(0x3F71073D69573EFD) }, { UINT64_C(0x3F6C58B381CD489A) }, { UINT64_C(0x3F66D888F3A1FC9B) },
+    { UINT64_C(0x3F61946BA8E1A0D9) }, { UINT64_C(0x3F592BB5540C39C6) }, { UINT64_C(0x3F4FB20AF78DF493) }, { UINT64_C(0x3F3DC31C329EFCFB) }
+};
+
+/* ======================================================================== */
+/* Scalar                                                                   */
+/* ======================================================================== */
+
+static uint64_t dist_load(const void *const ptr)
+{
+    uint64_t value;
+    memcpy(&value, ptr, sizeof(uint64_t));
+    return value;
+}
+
+static double dist_next_uniform(xxh64prng_stream_t *const stream)
+{
+    return ((double)(xxh64prng_next_u64(stream) >> 11)) * SCALE_DOUBLE;
+}
+
+static void dist_uniform_scalar(double *const data, const size_t count)
+{
+    size_t pos;
+    for (pos = 0U; pos < count; ++pos) {
+        data[pos] = ((double)(dist_load(data + pos) >> 11)) * SCALE_DOUBLE;
+    }
+}
+
+static void dist_uniform_f_scalar(float *const data, const size_t count)
+{
+    uint32_t value;
+    size_t pos;
+    for (pos = 0U; pos < count; ++pos) {
+        memcpy(&value, data + pos, sizeof(uint32_t));
+        data[pos] = ((float)(value >> 8)) * SCALE_FLOAT;
+    }
+}
+
+/* Fast path: converts all accepted values in-place, returns the positions of rejected values */
+static size_t dist_normal_scalar(double *const data, const size_t count, uint16_t *const rejected)
+{
+    size_t pos, num_rejected = 0U;
+    for (pos = 0U; pos < count; ++pos) {
+        const uint64_t r = dist_load(data + pos);
+        const size_t idx = (size_t)(r & 0xFFU);
+        const uint64_t rabs = (r >> 9) & MASK52;
+        if (rabs < ZIG_NOR_K[idx]) {
+            const double x = ((double)rabs) * ZIG_NOR_W[idx].d;
+            data[pos] = ((r >> 8) & 1U) ? (-x) : x;
+        }
+        else {
+            rejected[num_rejected++] = (uint16_t)pos;
+        }
+    }
+    return num_rejected;
+}
+
+static size_t dist_exponential_scalar(double *const data, const size_t count, uint16_t *const rejected)
+{
+    size_t pos, num_rejected = 0U;
+    for (pos = 0U; pos < count; ++pos) {
+        const uint64_t r = dist_load(data + pos) >> 3;
+        const size_t idx = (size_t)(r & 0xFFU);
+        const uint64_t rabs = r >> 8;
+        if (rabs < ZIG_EXP_K[idx]) {
+            data[pos] = ((double)rabs) * ZIG_EXP_W[idx].d;
+        }
+        else {
+            rejected[num_rejected++] = (uint16_t)pos;
+        }
+    }
+    return num_rejected;
+}
+
+/* Slow path: wedge and tail, drawing additional values from the stream as needed */
+static double dist_normal_slow(xxh64prng_stream_t *const stream, uint64_t r)
+{
+    for (;;) {
+        const size_t idx = (size_t)(r & 0xFFU);
+        const uint64_t rabs = (r >> 9) & MASK52;
+        const bool negative = ((r >> 8) & 1U) != 0U;
+        double x = ((double)rabs) * ZIG_NOR_W[idx].d;
+        if (negative) {
+            x = -x;
+        }
+        if (rabs < ZIG_NOR_K[idx]) {
+            return x;
+        }
+        if (idx == 0U) {
+            for (;;) {
+                const double xx = -log1p(-dist_next_uniform(stream)) / ZIG_NOR_R;
+                const double yy = -log1p(-dist_next_uniform(stream));
+                if ((yy + yy) > (xx * xx)) {
+                    return negative ? (-(ZIG_NOR_R + xx)) : (ZIG_NOR_R + xx);
+                }
+            }
+        }
+        if ((((ZIG_NOR_F[idx - 1U].d - ZIG_NOR_F[idx].d) * dist_next_uniform(stream)) + ZIG_NOR_F[idx].d) < exp(-0.5 * x * x)) {
+            return x;
+        }
+        r = xxh64prng_next_u64(stream);
+    }
+}
+
+static double dist_exponential_slow(xxh64prng_stream_t *const stream, uint64_t r)
+{
+    for (;;) {
+        const size_t idx = (size_t)((r >> 3) & 0xFFU);
+        const uint64_t rabs = r >> 11;
+        const double x = ((double)rabs) * ZIG_EXP_W[idx].d;
+        if (rabs < ZIG_EXP_K[idx]) {
+            return x;
+        }
+        if (idx == 0U) {
+            return ZIG_EXP_R - log1p(-dist_next_uniform(stream));
+        }
+        if ((((ZIG_EXP_F[idx - 1U].d - ZIG_EXP_F[idx].d) * dist_next_uniform(stream)) + ZIG_EXP_F[idx].d) < exp(-x)) {
+            return x;
+        }
+        r = xxh64prng_next_u64(stream);
+    }
+}
+
+/* ======================================================================== */
+/* x86: AVX2 / AVX-512                                                      */
+/* ======================================================================== */
+
+#if XXH_SIMD_X86
+
+/* Exact conversion of integers < 2^52 to double */
+#define DIST_MAGIC52 UINT64_C(0x4330000000000000)
+#define DIST_mm256_cvt52_pd(X) _mm256_sub_pd(_mm256_castsi256_pd(_mm256_or_si256((X), magic_i)), magic_d)
+
+XXH_TARGET_AVX2 static void dist_uniform_avx2(double *const data, const size_t count)
+{
+    const __m256i magic_i = _mm256_set1_epi64x((long long)DIST_MAGIC52);
+    const __m256d magic_d = _mm256_castsi256_pd(magic_i);
+    const __m256i mask32 = _mm256_set1_epi64x(0xFFFFFFFFLL);
+    const __m256d scale_hi = _mm256_set1_pd(4294967296.0 * SCALE_DOUBLE), scale_lo = _mm256_set1_pd(SCALE_DOUBLE);
+    size_t pos;
+
+    for (pos = 0U; pos + 4U <= count; pos += 4U) {
+        const __m256i r = _mm256_srli_epi64(_mm256_loadu_si256((const __m256i*)(data + pos)), 11);
+        const __m256d hi = DIST_mm256_cvt52_pd(_mm256_srli_epi64(r, 32));
+        const __m256d lo = DIST_mm256_cvt52_pd(_mm256_and_si256(r, mask32));
+        _mm256_storeu_pd(data + pos, _mm256_add_pd(_mm256_mul_pd(hi, scale_hi), _mm256_mul_pd(lo, scale_lo)));
+    }
+
+    dist_uniform_scalar(data + pos, count - pos);
+}
+
+XXH_TARGET_AVX2 static void dist_uniform_f_avx2(float *const data, const size_t count)
+{
+    const __m256 scale = _mm256_set1_ps(SCALE_FLOAT);
+    size_t pos;
+
+    for (pos = 0U; pos + 8U <= count; pos += 8U) {
+        const __m256i r = _mm256_srli_epi32(_mm256_loadu_si256((const __m256i*)(data + pos)), 8);
+        _mm256_storeu_ps(data + pos, _mm256_mul_ps(_mm256_cvtepi32_ps(r), scale));
+    }
+
+    dist_uniform_f_scalar(data + pos, count - pos);
+}
+
+XXH_TARGET_AVX2 static size_t dist_normal_avx2(double *const data, const size_t count, uint16_t *const rejected)
+{
+    const __m256i magic_i = _mm256_set1_epi64x((long long)DIST_MAGIC52);
+    const __m256d magic_d = _mm256_castsi256_pd(magic_i);
+    const __m256i mask8 = _mm256_set1_epi64x(0xFF), mask52 = _mm256_set1_epi64x((long long)MASK52);
+    size_t pos, num_rejected = 0U;
+    int accept;
+
+    for (pos = 0U; pos + 4U <= count; pos += 4U) {
+        const __m256i r = _mm256_loadu_si256((const __m256i*)(data + pos));
+        const __m256i idx = _mm256_and_si256(r, mask8);
+        const __m256i rabs = _mm256_and_si256(_mm256_srli_epi64(r, 9), mask52);
+        const __m256i sign = _mm256_slli_epi64(_mm256_srli_epi64(r, 8), 63);
+        const __m256i k = _mm256_i64gather_epi64((const long long*)ZIG_NOR_K, idx, 8);
+        const __m256d w = _mm256_i64gather_pd((const double*)ZIG_NOR_W, idx, 8);
+        const __m256i ok = _mm256_cmpgt_epi64(k, rabs);
+        const __m256i x = _mm256_xor_si256(_mm256_castpd_si256(_mm256_mul_pd(DIST_mm256_cvt52_pd(rabs), w)), sign);
+        _mm256_storeu_si256((__m256i*)(data + pos), _mm256_blendv_epi8(r, x, ok));
+        if ((accept = _mm256_movemask_pd(_mm256_castsi256_pd(ok))) != 0xF) {
+            unsigned lane;
+            for (lane = 0U; lane < 4U; ++lane) {
+                if (!(accept & (1 << lane))) {
+                    rejected[num_rejected++] = (uint16_t)(pos + lane);
+                }
+            }
+        }
+    }
+
+    if (pos < count) {
+        const size_t tail = dist_normal_scalar(data + pos, count - pos, rejected + num_rejected);
+        size_t i;
+        for (i = 0U; i < tail; ++i) {
+            rejected[num_rejected + i] += (uint16_t)pos;
+        }
+        num_rejected += tail;
+    }
+
+    return num_rejected;
+}
+
+XXH_TARGET_AVX2 static size_t dist_exponential_avx2(double *const data, const size_t count, uint16_t *const rejected)
+{
+    const __m256i magic_i = _mm256_set1_epi64x((long long)DIST_MAGIC52);
+    const __m256d magic_d = _mm256_castsi256_pd(magic_i);
+    const __m256i mask8 = _mm256_set1_epi64x(0xFF), mask32 = _mm256_set1_epi64x(0xFFFFFFFFLL);
+    const __m256d two32 = _mm256_set1_pd(4294967296.0);
+    size_t pos, num_rejected = 0U;
+    int accept;
+
+    for (pos = 0U; pos + 4U <= count; pos += 4U) {
+        const __m256i r = _mm256_loadu_si256((const __m256i*)(data + pos));
+        const __m256i idx = _mm256_and_si256(_mm256_srli_epi64(r, 3), mask8);
+        const __m256i rabs = _mm256_srli_epi64(r, 11);
+        const __m256i k = _mm256_i64gather_epi64((const long long*)ZIG_EXP_K, idx, 8);
+        const __m256d w = _mm256_i64gather_pd((const double*)ZIG_EXP_W, idx, 8);
+        const __m256i ok = _mm256_cmpgt_epi64(k, rabs);
+        const __m256d value = _mm256_add_pd(_mm256_mul_pd(DIST_mm256_cvt52_pd(_mm256_srli_epi64(rabs, 32)), two32), DIST_mm256_cvt52_pd(_mm256_and_si256(rabs, mask32)));
+        const __m256i x = _mm256_castpd_si256(_mm256_mul_pd(value, w));
+        _mm256_storeu_si256((__m256i*)(data + pos), _mm256_blendv_epi8(r, x, ok));
+        if ((accept = _mm256_movemask_pd(_mm256_castsi256_pd(ok))) != 0xF) {
+            unsigned lane;
+            for (lane = 0U; lane < 4U; ++lane) {
+                if (!(accept & (1 << lane))) {
+                    rejected[num_rejected++] = (uint16_t)(pos + lane);
+                }
+            }
+        }
+    }
+
+    if (pos < count) {
+        const size_t tail = dist_exponential_scalar(data + pos, count - pos, rejected + num_rejected);
+        size_t i;
+        for (i = 0U; i < tail; ++i) {
+            rejected[num_rejected + i] += (uint16_t)pos;
+        }
+        num_rejected += tail;
+    }
+
+    return num_rejected;
+}
+
+XXH_TARGET_AVX512 static void dist_uniform_avx512(double *const data, const size_t count)
+{
+    const __m512d scale = _mm512_set1_pd(SCALE_DOUBLE);
+    size_t pos;
+
+    for (pos = 0U; pos + 8U <= count; pos += 8U) {
+        const __m512i r = _mm512_srli_epi64(_mm512_loadu_si512((const void*)(data + pos)), 11);
+        _mm512_storeu_pd(data + pos, _mm512_mul_pd(_mm512_cvtepu64_pd(r), scale));
+    }
+
+    dist_uniform_scalar(data + pos, count - pos);
+}
+
+XXH_TARGET_AVX512 static void dist_uniform_f_avx512(float *const data, const size_t count)
+{
+    const __m512 scale = _mm512_set1_ps(SCALE_FLOAT);
+    size_t pos;
+
+    for (pos = 0U; pos + 16U <= count; pos += 16U) {
+        const __m512i r = _mm512_srli_epi32(_mm512_loadu_si512((const void*)(data + pos)), 8);
+        _mm512_storeu_ps(data + pos, _mm512_mul_ps(_mm512_cvtepi32_ps(r), scale));
+    }
+
+    dist_uniform_f_scalar(data + pos, count - pos);
+}
+
+XXH_TARGET_AVX512 static size_t dist_normal_avx512(double *const data, const size_t count, uint16_t *const rejected)
+{
+    const __m512i mask8 = _mm512_set1_epi64(0xFF), mask52 = _mm512_set1_epi64((long long)MASK52);
+    size_t pos, num_rejected = 0U;
+    __mmask8 accept;
+
+    for (pos = 0U; pos + 8U <= count; pos += 8U) {
+        const __m512i r = _mm512_loadu_si512((const void*)(data + pos));
+        const __m512i idx = _mm512_and_si512(r, mask8);
+        const __m512i rabs = _mm512_and_si512(_mm512_srli_epi64(r, 9), mask52);
+        const __m512i sign = _mm512_slli_epi64(_mm512_srli_epi64(r, 8), 63);
+        const __m512i k = _mm512_i64gather_epi64(idx, (const void*)ZIG_NOR_K, 8);
+        const __m512d w = _mm512_i64gather_pd(idx, (const void*)ZIG_NOR_W, 8);
+        const __m512i x = _mm512_xor_si512(_mm512_castpd_si512(_mm512_mul_pd(_mm512_cvtepu64_pd(rabs), w)), sign);
+        accept = _mm512_cmplt_epu64_mask(rabs, k);
+        _mm512_storeu_si512((void*)(data + pos), _mm512_mask_blend_epi64(accept, r, x));
+        if (accept != 0xFF) {
+            unsigned lane;
+            for (lane = 0U; lane < 8U; ++lane) {
+                if (!(accept & (1U << lane))) {
+                    rejected[num_rejected++] = (uint16_t)(pos + lane);
+                }
+            }
+        }
+    }
+
+    if (pos < count) {
+        const size_t tail = dist_normal_scalar(data + pos, count - pos, rejected + num_rejected);
+        size_t i;
+        for (i = 0U; i < tail; ++i) {
+            rejected[num_rejected + i] += (uint16_t)pos;
+        }
+        num_rejected += tail;
+    }
+
+    return num_rejected;
+}
+
+XXH_TARGET_AVX512 static size_t dist_exponential_avx512(double *const data, const size_t count, uint16_t *const rejected)
+{
+    const __m512i mask8 = _mm512_set1_epi64(0xFF);
+    size_t pos, num_rejected = 0U;
+    __mmask8 accept;
+
+    for (pos = 0U; pos + 8U <= count; pos += 8U) {
+        const __m512i r = _mm512_loadu_si512((const void*)(data + pos));
+        const __m512i idx = _mm512_and_si512(_mm512_srli_epi64(r, 3), mask8);
+        const __m512i rabs = _mm512_srli_epi64(r, 11);
+        const __m512i k = _mm512_i64gather_epi64(idx, (const void*)ZIG_EXP_K, 8);
+        const __m512d w = _mm512_i64gather_pd(idx, (const void*)ZIG_EXP_W, 8);
+        const __m512i x = _mm512_castpd_si512(_mm512_mul_pd(_mm512_cvtepu64_pd(rabs), w));
+        accept = _mm512_cmplt_epu64_mask(rabs, k);
+        _mm512_storeu_si512((void*)(data + pos), _mm512_mask_blend_epi64(accept, r, x));
+        if (accept != 0xFF) {
+            unsigned lane;
+            for (lane = 0U; lane < 8U; ++lane) {
+                if (!(accept & (1U << lane))) {
+                    rejected[num_rejected++] = (uint16_t)(pos + lane);
+                }
+            }
+        }
+    }
+
+    if (pos < count) {
+        const size_t tail = dist_exponential_scalar(data + pos, count - pos, rejected + num_rejected);
+        size_t i;
+        for (i = 0U; i < tail; ++i) {
+            rejected[num_rejected + i] += (uint16_t)pos;
+        }
+        num_rejected += tail;
+    }
+
+    return num_rejected;
+}
+
+#endif /*XXH_SIMD_X86*/
+
+/* ======================================================================== */
+/* ARM64: NEON                                                              */
+/* ======================================================================== */
+
+#if XXH_SIMD_NEON
+
+static void dist_uniform_neon(double *const data, const size_t count)
+{
+    const float64x2_t scale = vdupq_n_f64(SCALE_DOUBLE);
+    size_t pos;
+
+    for (pos = 0U; pos + 2U <= count; pos += 2U) {
+        const uint64x2_t r = vshrq_n_u64(vreinterpretq_u64_u8(vld1q_u8((const uint8_t*)(data + pos))), 11);
+        vst1q_f64(data + pos, vmulq_f64(vcvtq_f64_u64(r), scale));
+    }
+
+    dist_uniform_scalar(data + pos, count - pos);
+}
+
+static void dist_uniform_f_neon(float *const data, const size_t count)
+{
+    const float32x4_t scale = vdupq_n_f32(SCALE_FLOAT);
+    size_t pos;
+
+    for (pos = 0U; pos + 4U <= count; pos += 4U) {
+        const uint32x4_t r = vshrq_n_u32(vreinterpretq_u32_u8(vld1q_u8((const uint8_t*)(data + pos))), 8);
+        vst1q_f32(data + pos, vmulq_f32(vcvtq_f32_u32(r), scale));
+    }
+
+    dist_uniform_f_scalar(data + pos, count - pos);
+}
+
+#endif /*XXH_SIMD_NEON*/
+
+/* ======================================================================== */
+/* Kernel selection                                                         */
+/* ======================================================================== */
+
+typedef struct dist_kernels {
+    void (*uniform)(double *const data, const size_t count);
+    void (*uniform_f)(float *const data, const size_t count);
+    size_t (*normal)(double *const data, const size_t count, uint16_t *const rejected);
+    size_t (*exponential)(double *const data, const size_t count, uint16_t *const rejected);
+} dist_kernels_t;
+
+static const dist_kernels_t DIST_SCALAR = { dist_uniform_scalar, dist_uniform_f_scalar, dist_normal_scalar, dist_exponential_scalar };
+#if XXH_SIMD_X86
+static const dist_kernels_t DIST_AVX2 = { dist_uniform_avx2, dist_uniform_f_avx2, dist_normal_avx2, dist_exponential_avx2 };
+static const dist_kernels_t DIST_AVX512 = { dist_uniform_avx512, dist_uniform_f_avx512, dist_normal_avx512, dist_exponential_avx512 };
+#endif
+#if XXH_SIMD_NEON
+static const dist_kernels_t DIST_NEON = { dist_uniform_neon, dist_uniform_f_neon, dist_normal_scalar, dist_exponential_scalar };
+#endif
+
+/* All kernels produce identical results, so simply follow the selected implementation */
+static const dist_kernels_t *dist_kernels(void)
+{
+    switch (xxh64prng_get_impl()) {
+#if XXH_SIMD_X86
+    case XXH64PRNG_IMPL_AVX2:
+        return &DIST_AVX2;
+    case XXH64PRNG_IMPL_AVX512:
+        return &DIST_AVX512;
+#endif
+#if XXH_SIMD_NEON
+    case XXH64PRNG_IMPL_NEON:
+        return &DIST_NEON;
+#endif
+    default:
+        return &DIST_SCALAR;
+    }
+}
+
+/* ======================================================================== */
+/* Batch distribution functions                                             */
+/* ======================================================================== */
+
+/* Fill array with uniformly distributed doubles in the range [0, 1) */
+XXH64PRNG_API void xxh64prng_fill_uniform(xxh64prng_stream_t *const stream, double *const out, const size_t count)
+{
+    const dist_kernels_t *const kernels = dist_kernels();
+    size_t offset;
+
+    for (offset = 0U; offset < count; offset += DIST_CHUNK) {
+        const size_t chunk_size = ((count - offset) < DIST_CHUNK) ? (count - offset) : DIST_CHUNK;
+        xxh64prng_fill(stream, out + offset, chunk_size * sizeof(double));
+        kernels->uniform(out + offset, chunk_size);
+    }
+}
+
+/* Fill array with uniformly distributed floats in the range [0, 1) */
+XXH64PRNG_API void xxh64prng_fill_uniform_f(xxh64prng_stream_t *const stream, float *const out, const size_t count)
+{
+    const dist_kernels_t *const kernels = dist_kernels();
+    size_t offset;
+
+    for (offset = 0U; offset < count; offset += DIST_CHUNK) {
+        const size_t chunk_size = ((count - offset) < DIST_CHUNK) ? (count - offset) : DIST_CHUNK;
+        xxh64prng_fill(stream, out + offset, chunk_size * sizeof(float));
+        kernels->uniform_f(out + offset, chunk_size);
+    }
+}
+
+/* Fill array with standard normally distributed doubles (mean 0, variance 1) */
+XXH64PRNG_API void xxh64prng_fill_normal(xxh64prng_stream_t *const stream, double *const out, const size_t count)
+{
+    const dist_kernels_t *const kernels = dist_kernels();
+    uint16_t rejected[DIST_CHUNK];
+    size_t offset, pos, num_rejected;
+
+    for (offset = 0U; offset < count; offset += DIST_CHUNK) {
+        const size_t chunk_size = ((count - offset) < DIST_CHUNK) ? (count - offset) : DIST_CHUNK;
+        double *const data = out + offset;
+        xxh64prng_fill(stream, data, chunk_size * sizeof(double));
+        num_rejected = kernels->normal(data, chunk_size, rejected);
+        for (pos = 0U; pos < num_rejected; ++pos) {
+            data[rejected[pos]] = dist_normal_slow(stream, dist_load(data + rejected[pos]));
+        }
+    }
+}
+
+/* Fill array with exponentially distributed doubles (rate 1) */
+XXH64PRNG_API void xxh64prng_fill_exponential(xxh64prng_stream_t *const stream, double *const out, const size_t count)
+{
+    const dist_kernels_t *const kernels = dist_kernels();
+    uint16_t rejected[DIST_CHUNK];
+    size_t offset, pos, num_rejected;
+
+    for (offset = 0U; offset < count; offset += DIST_CHUNK) {
+        const size_t chunk_size = ((count - offset) < DIST_CHUNK) ? (count - offset) : DIST_CHUNK;
+        double *const data = out + offset;
+        xxh64prng_fill(stream, data, chunk_size * sizeof(double));
+        num_rejected = kernels->exponential(data, chunk_size, rejected);
+        for (pos = 0U; pos < num_rejected; ++pos) {
+            data[rejected[pos]] = dist_exponential_slow(stream, dist_load(data + rejected[pos]));
+        }
+    }
+}
@@ -0,0 +1,301 @@
+/*
+ * XXH64-PRNG
+ * Blazing fast XXH64-based secure pseudo-random number generator
+ *
+ * Copyright (c) 2025 "dEajL3kA" <Cumpoing79@web.de>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * https://www.opensource.org/licenses/bsd-license.php
+ */
+
+#include <xxh64_prng.h>
+
+#include "xxh64_prng_core.h"
+#include "os_support.h"
+#include <string.h>
+
+/* number of blocks that is advanced by the state chain in one batch */
+#define MT_BATCH_BLOCKS 1024U
+
+/* number of blocks that a worker claims at a time */
+#define MT_CHUNK_BLOCKS 16U
+
+/* smaller requests are not worth distributing */
+#define MT_MIN_BYTES (2U * MT_CHUNK_BLOCKS * XXH64PRNG_OUTPUT_BYTES)
+
+/* ======================================================================== */
+/* Worker pool                                                              */
+/* ======================================================================== */
+
+struct xxh64prng_mt {
+    xxh64prng_os_monitor_t *monitor;
+    xxh64prng_os_thread_t **threads;
+    size_t thread_count;
+    uint64_t *temp[2U];
+    /* current job, protected by monitor */
+    uint64_t job_id;
+    const uint64_t *job_temp;
+    uint8_t *job_out;
+    size_t job_total, job_next, job_done;
+    bool shutdown;
+};
+
+/* Claim and expand chunks of the current job until none are left; monitor must be held */
+static void xxh64prng_mt_work(xxh64prng_mt_t *const mt)
+{
+    while (mt->job_next < mt->job_total) {
+        const size_t first = mt->job_next;
+        const size_t count = ((mt->job_total - first) < MT_CHUNK_BLOCKS) ? (mt->job_total - first) : MT_CHUNK_BLOCKS;
+        const uint64_t *temp = mt->job_temp + (first * _XXH64PRNG_TEMP_WORDS);
+        uint8_t *out = mt->job_out + (first * XXH64PRNG_OUTPUT_BYTES);
+        size_t pos;
+
+        mt->job_next += count;
+        xxh64prng_os_monitor_leave(mt->monitor);
+
+        for (pos = 0U; pos < count; ++pos) {
+            xxh64prng_core_expand(temp, out);
+            temp += _XXH64PRNG_TEMP_WORDS;
+            out += XXH64PRNG_OUTPUT_BYTES;
+        }
+
+        xxh64prng_os_monitor_enter(mt->monitor);
+        if ((mt->job_done += count) >= mt->job_total) {
+            xxh64prng_os_monitor_notify(mt->monitor);
+        }
+    }
+}
+
+static void xxh64prng_mt_thread_main(void *const arg)
+{
+    xxh64prng_mt_t *const mt = (xxh64prng_mt_t*)arg;
+    uint64_t last_job = 0U;
+
+    xxh64prng_os_monitor_enter(mt->monitor);
+
+    for (;;) {
+        while ((mt->job_id == last_job) && (!mt->shutdown)) {
+            xxh64prng_os_monitor_wait(mt->monitor);
+        }
+        if (mt->shutdown) {
+            break;
+        }
+        last_job = mt->job_id;
+        xxh64prng_mt_work(mt);
+    }
+
+    xxh64prng_os_monitor_leave(mt->monitor);
+}
+
+/* Create worker pool, "threads" is the *total* number of threads, including the caller (0 = number of CPUs) */
+XXH64PRNG_API xxh64prng_mt_t *xxh64prng_mt_create(size_t threads)
+{
+    xxh64prng_mt_t *mt;
+    size_t pos;
+
+    if (!threads) {
+        threads = xxh64prng_os_cpu_count();
+    }
+
+    if (!(mt = (xxh64prng_mt_t*)calloc(1U, sizeof(xxh64prng_mt_t)))) {
+        return NULL;
+    }
+
+    mt->monitor = xxh64prng_os_monitor_create();
+    mt->threads = (xxh64prng_os_thread_t**)calloc(threads, sizeof(xxh64prng_os_thread_t*));
+    mt->temp[0U] = (uint64_t*)malloc(MT_BATCH_BLOCKS * _XXH64PRNG_TEMP_WORDS * sizeof(uint64_t));
+    mt->temp[1U] = (uint64_t*)malloc(MT_BATCH_BLOCKS * _XXH64PRNG_TEMP_WORDS * sizeof(uint64_t));
+
+    if (!(mt->monitor && mt->threads && mt->temp[0U] && mt->temp[1U])) {
+        xxh64prng_mt_destroy(mt);
+        return NULL;
+    }
+
+    for (pos = 1U; pos < threads; ++pos) {
+        if (!(mt->threads[mt->thread_count] = xxh64prng_os_thread_create(xxh64prng_mt_thread_main, mt))) {
+            xxh64prng_mt_destroy(mt);
+            return NULL;
+        }
+        ++mt->thread_count;
+    }
+
+    return mt;
+}
+
+/* Stop all workers and release the pool */
+XXH64PRNG_API void xxh64prng_mt_destroy(xxh64prng_mt_t *const mt)
+{
+    size_t pos;
+
+    if (!mt) {
+        return;
+    }
+
+    if (mt->monitor) {
+        xxh64prng_os_monitor_enter(mt->monitor);
+        mt->shutdown = true;
+        xxh64prng_os_monitor_notify(mt->monitor);
+        xxh64prng_os_monitor_leave(mt->monitor);
+    }
+
+    for (pos = 0U; pos < mt->thread_count; ++pos) {
+        xxh64prng_os_thread_join(mt->threads[pos]);
+    }
+
+    if (mt->monitor) {
+        xxh64prng_os_monitor_destroy(mt->monitor);
+    }
+
+    free(mt->threads);
+    free(mt->temp[0U]);
+    free(mt->temp[1U]);
+    free(mt);
+}
+
+/* ======================================================================== */
+/* Parallel bulk generator                                                  */
+/* ======================================================================== */
+
+/* Source of the intermediate values: either the state chain or the counter */
+typedef struct mt_source {
+    xxh64prng_t *state;
+    const uint64_t *key;
+    uint64_t counter;
+} mt_source_t;
+
+static void xxh64prng_mt_advance(mt_source_t *const source, uint64_t *temp, const size_t count)
+{
+    size_t pos;
+    for (pos = 0U; pos < count; ++pos) {
+        if (source->state) {
+            xxh64prng_core_advance(source->state, temp);
+        }
+        else {
+            xxh64prng_core_counter(source->key, source->counter++, temp);
+        }
+        temp += _XXH64PRNG_TEMP_WORDS;
+    }
+}
+
+/*
+ * Generate "count" whole blocks using the worker pool. The calling thread
+ * computes the intermediate values one batch ahead, while the workers (and
+ * then the caller) expand the blocks of the current batch directly into
+ * their final place in the buffer.
+ */
+static void xxh64prng_mt_run(xxh64prng_mt_t *const mt, mt_source_t *const source, uint8_t *out, size_t count)
+{
+    size_t batch, next_batch;
+    unsigned current = 0U;
+
+    batch = (count < MT_BATCH_BLOCKS) ? count : MT_BATCH_BLOCKS;
+    xxh64prng_mt_advance(source, mt->temp[current], batch);
+
+    while (batch > 0U) {
+        xxh64prng_os_monitor_enter(mt->monitor);
+        ++mt->job_id;
+        mt->job_temp = mt->temp[current];
+        mt->job_out = out;
+        mt->job_total = batch;
+        mt->job_next = mt->job_done = 0U;
+        xxh64prng_os_monitor_notify(mt->monitor);
+        xxh64prng_os_monitor_leave(mt->monitor);
+
+        count -= batch;
+        out += batch * XXH64PRNG_OUTPUT_BYTES;
+
+        next_batch = (count < MT_BATCH_BLOCKS) ? count : MT_BATCH_BLOCKS;
+        xxh64prng_mt_advance(source, mt->temp[current ^ 1U], next_batch);
+
+        xxh64prng_os_monitor_enter(mt->monitor);
+        xxh64prng_mt_work(mt);
+        while (mt->job_done < mt->job_total) {
+            xxh64prng_os_monitor_wait(mt->monitor);
+        }
+        xxh64prng_os_monitor_leave(mt->monitor);
+
+        if (xxh64prng_get_wipe() != XXH64PRNG_WIPE_OFF) {
+            xxh64prng_zero(mt->temp[current], batch * _XXH64PRNG_TEMP_WORDS * sizeof(uint64_t));
+        }
+        current ^= 1U;
+        batch = next_batch;
+    }
+}
+
+/* Fill buffer using the worker pool, the result is byte-identical to xxh64prng_fill() */
+XXH64PRNG_API void xxh64prng_mt_fill(xxh64prng_mt_t *const mt, xxh64prng_stream_t *const stream, void *const buf, size_t len)
+{
+    uint8_t *out = (uint8_t*)buf;
+    mt_source_t source = { NULL, NULL, 0U };
+    size_t count;
+
+    if ((!mt->thread_count) || (len < MT_MIN_BYTES)) {
+        xxh64prng_fill(stream, buf, len);
+        return;
+    }
+
+    if (stream->offset < XXH64PRNG_OUTPUT_BYTES) {
+        const size_t avail = XXH64PRNG_OUTPUT_BYTES - stream->offset;
+        xxh64prng_fill(stream, out, avail);
+        out += avail;
+        len -= avail;
+    }
+
+    source.state = &stream->prng;
+    count = len / XXH64PRNG_OUTPUT_BYTES;
+    xxh64prng_mt_run(mt, &source, out, count);
+
+    if ((len -= count * XXH64PRNG_OUTPUT_BYTES) > 0U) {
+        xxh64prng_fill(stream, out + (count * XXH64PRNG_OUTPUT_BYTES), len);
+    }
+}
+
+/* Fill buffer using the worker pool, the result is byte-identical to xxh64prng_ctr_fill() */
+XXH64PRNG_API void xxh64prng_mt_ctr_fill(xxh64prng_mt_t *const mt, xxh64prng_ctr_t *const ctr, void *const buf, size_t len)
+{
+    uint8_t *out = (uint8_t*)buf;
+    mt_source_t source = { NULL, NULL, 0U };
+    size_t count;
+
+    if ((!mt->thread_count) || (len < MT_MIN_BYTES)) {
+        xxh64prng_ctr_fill(ctr, buf, len);
+        return;
+    }
+
+    if (ctr->offset < XXH64PRNG_OUTPUT_BYTES) {
+        const size_t avail = XXH64PRNG_OUTPUT_BYTES - ctr->offset;
+        xxh64prng_ctr_fill(ctr, out, avail);
+        out += avail;
+        len -= avail;
+    }
+
+    source.key = ctr->key;
+    source.counter = ctr->counter;
+    count = len / XXH64PRNG_OUTPUT_BYTES;
+    xxh64prng_mt_run(mt, &source, out, count);
+    ctr->counter = source.counter;
+
+    if ((len -= count * XXH64PRNG_OUTPUT_BYTES) > 0U) {
+        xxh64prng_ctr_fill(ctr, out + (count * XXH64PRNG_OUTPUT_BYTES), len);
+    }
+}
@@ -0,0 +1,365 @@
+/*
+ * XXH64-PRNG
+ * Blazing fast XXH64-based secure pseudo-random number generator
+ *
+ * Copyright (c) 2025 "dEajL3kA" <Cumpoing79@web.de>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * https://www.opensource.org/licenses/bsd-license.php
+ */
+
+#include <xxh64_prng.h>
+
+#include "os_support.h"
+#include <string.h>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#  include <intrin.h>
+#endif
+
+/* default number of queued blocks per generator */
+#define POOL_DEFAULT_QUEUE 8U
+
+/* upper limits, the ring indices are free-running 32-Bit counters */
+#define POOL_MAX_QUEUE 4096U
+#define POOL_MAX_SLOTS 65536U
+
+/* all members that are written by different threads live in separate cache lines */
+#define POOL_LINE_BYTES 64U
+
+/* ======================================================================== */
+/* Atomic operations                                                        */
+/* ======================================================================== */
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#  define POOL_LOAD(PTR) ((uint32_t)_InterlockedOr((volatile long*)(PTR), 0L))
+#  define POOL_STORE(PTR, VALUE) ((void)_InterlockedExchange((volatile long*)(PTR), (long)(VALUE)))
+#  define POOL_EXCHANGE(PTR, VALUE) ((uint32_t)_InterlockedExchange((volatile long*)(PTR), (long)(VALUE)))
+#  define POOL_CAS(PTR, EXPECTED, VALUE) (_InterlockedCompareExchange((volatile long*)(PTR), (long)(VALUE), (long)(EXPECTED)) == (long)(EXPECTED))
+#  define POOL_FENCE() ((void)0) /* every operation above is a full barrier */
+#else
+#  define POOL_LOAD(PTR) __atomic_load_n((PTR), __ATOMIC_ACQUIRE)
+#  define POOL_STORE(PTR, VALUE) __atomic_store_n((PTR), (VALUE), __ATOMIC_RELEASE)
+#  define POOL_EXCHANGE(PTR, VALUE) __atomic_exchange_n((PTR), (VALUE), __ATOMIC_SEQ_CST)
+#  define POOL_CAS(PTR, EXPECTED, VALUE) __extension__ ({ uint32_t _expected = (EXPECTED); __atomic_compare_exchange_n((PTR), &_expected, (VALUE), false, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED); })
+#  define POOL_FENCE() __atomic_thread_fence(__ATOMIC_SEQ_CST)
+#endif
+
+/* ======================================================================== */
+/* Pool                                                                     */
+/* ======================================================================== */
+
+/*
+ * Every slot is a generator with a ring of pre-generated blocks. The ring is
+ * a single-producer/single-consumer queue: the owning thread consumes at
+ * "head", while the producer appends at "tail". Either the refiller thread or,
+ * if the ring has run empty, the owning thread itself can be the producer;
+ * the "busy" flag makes sure that only one of them advances the state at a
+ * time. The block at "head" is the current block of the owning thread.
+ */
+typedef struct pool_slot {
+    union {
+        struct {
+            xxh64prng_local_t local; /* must be the first member */
+            xxh64prng_pool_t *pool;
+            uint32_t head;
+        } data;
+        uint8_t pad[POOL_LINE_BYTES];
+    } consumer;
+    union {
+        struct {
+            uint32_t tail, busy;
+        } data;
+        uint8_t pad[POOL_LINE_BYTES];
+    } producer;
+    union {
+        uint32_t in_use;
+        uint8_t pad[POOL_LINE_BYTES];
+    } owner;
+    xxh64prng_t state; /* protected by "busy" */
+} pool_slot_t;
+
+struct xxh64prng_pool {
+    void *memory;
+    uint8_t *slots;
+    size_t slot_count, slot_size;
+    uint32_t queue_blocks;
+    xxh64prng_os_monitor_t *monitor;
+    xxh64prng_os_thread_t *refiller;
+    bool shutdown; /* protected by monitor */
+    union {
+        uint32_t value;
+        uint8_t pad[POOL_LINE_BYTES];
+    } sleeping;
+};
+
+#define POOL_SLOT(POOL, INDEX) ((pool_slot_t*)((POOL)->slots + ((INDEX) * (POOL)->slot_size)))
+#define POOL_RING(SLOT) (((uint8_t*)(SLOT)) + sizeof(pool_slot_t))
+
+/* Append "count" blocks to the ring, the caller must hold the "busy" flag */
+static void pool_produce(xxh64prng_pool_t *const pool, pool_slot_t *const slot, size_t count)
+{
+    uint32_t tail = slot->producer.data.tail;
+    while (count-- > 0U) {
+        xxh64prng_next(&slot->state, (uint64_t*)(POOL_RING(slot) + ((tail % pool->queue_blocks) * XXH64PRNG_OUTPUT_BYTES)));
+        POOL_STORE(&slot->producer.data.tail, ++tail);
+    }
+}
+
+/* Top up all rings that are not full, returns true if any blocks have been generated */
+static bool pool_refill(xxh64prng_pool_t *const pool)
+{
+    bool generated = false;
+    size_t index;
+
+    for (index = 0U; index < pool->slot_count; ++index) {
+        pool_slot_t *const slot = POOL_SLOT(pool, index);
+        if ((POOL_LOAD(&slot->producer.data.tail) - POOL_LOAD(&slot->consumer.data.head)) < pool->queue_blocks) {
+            if (POOL_CAS(&slot->producer.data.busy, 0U, 1U)) {
+                const uint32_t queued = slot->producer.data.tail - POOL_LOAD(&slot->consumer.data.head);
+                if (queued < pool->queue_blocks) {
+                    pool_produce(pool, slot, pool->queue_blocks - queued);
+                    generated = true;
+                }
+                POOL_STORE(&slot->producer.data.busy, 0U);
+            }
+        }
+    }
+
+    return generated;
+}
+
+/* Check whether any ring is not full */
+static bool pool_pending(xxh64prng_pool_t *const pool)
+{
+    size_t index;
+    for (index = 0U; index < pool->slot_count; ++index) {
+        pool_slot_t *const slot = POOL_SLOT(pool, index);
+        if ((POOL_LOAD(&slot->producer.data.tail) - POOL_LOAD(&slot->consumer.data.head)) < pool->queue_blocks) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/*
+ * The refiller sleeps when all rings are full. Before it goes to sleep, it
+ * sets the "sleeping" flag and then re-checks the rings; a consumer advances
+ * its "head" and then checks the flag. Both are sequentially consistent, so at
+ * least one of them sees the other's update, and no wake-up is lost.
+ */
+static void pool_refiller_main(void *const arg)
+{
+    xxh64prng_pool_t *const pool = (xxh64prng_pool_t*)arg;
+    bool shutdown = false;
+
+    while (!shutdown) {
+        if (pool_refill(pool)) {
+            continue;
+        }
+        xxh64prng_os_monitor_enter(pool->monitor);
+        POOL_EXCHANGE(&pool->sleeping.value, 1U);
+        POOL_FENCE();
+        if (!(pool->shutdown || pool_pending(pool))) {
+            while (POOL_LOAD(&pool->sleeping.value) && (!pool->shutdown)) {
+                xxh64prng_os_monitor_wait(pool->monitor);
+            }
+        }
+        POOL_STORE(&pool->sleeping.value, 0U);
+        shutdown = pool->shutdown;
+        xxh64prng_os_monitor_leave(pool->monitor);
+    }
+}
+
+static void pool_wake(xxh64prng_pool_t *const pool)
+{
+    if (POOL_LOAD(&pool->sleeping.value) && POOL_EXCHANGE(&pool->sleeping.value, 0U)) {
+        xxh64prng_os_monitor_enter(pool->monitor);
+        xxh64prng_os_monitor_notify(pool->monitor);
+        xxh64prng_os_monitor_leave(pool->monitor);
+    }
+}
+
+/* Hand the current block back to the producer and move on to the next one, generating it if the ring is empty */
+static void pool_next_block(pool_slot_t *const slot)
+{
+    xxh64prng_pool_t *const pool = slot->consumer.data.pool;
+    const uint32_t head = slot->consumer.data.head + 1U;
+    uint32_t queued;
+
+    POOL_EXCHANGE(&slot->consumer.data.head, head);
+    POOL_FENCE();
+    queued = POOL_LOAD(&slot->producer.data.tail) - head;
+
+    if (pool->refiller && (queued <= (pool->queue_blocks / 2U))) {
+        pool_wake(pool);
+    }
+
+    while (!queued) {
+        if (POOL_CAS(&slot->producer.data.busy, 0U, 1U)) {
+            if (!(queued = slot->producer.data.tail - head)) {
+                pool_produce(pool, slot, 1U);
+                queued = 1U;
+            }
+            POOL_STORE(&slot->producer.data.busy, 0U);
+        }
+        else {
+            xxh64prng_os_thread_yield();
+            queued = POOL_LOAD(&slot->producer.data.tail) - head;
+        }
+    }
+
+    slot->consumer.data.local.block = (const uint64_t*)(POOL_RING(slot) + ((head % pool->queue_blocks) * XXH64PRNG_OUTPUT_BYTES));
+    slot->consumer.data.local.offset = 0U;
+}
+
+/*
+ * Create a pool of "slots" generators (0 = number of CPUs), each of which is
+ * derived from "master" with its slot index as ID and pre-generates up to
+ * "queue_blocks" blocks (0 = default). If "refiller" is true, a background
+ * thread keeps the queues topped up; otherwise, the owning thread generates
+ * the blocks when its queue has run empty.
+ */
+XXH64PRNG_API xxh64prng_pool_t *xxh64prng_pool_create(const xxh64prng_t *const master, size_t slots, size_t queue_blocks, const bool refiller)
+{
+    xxh64prng_pool_t *pool;
+    size_t index, slot_size;
+
+    if (!slots) {
+        slots = xxh64prng_os_cpu_count();
+    }
+    if (!queue_blocks) {
+        queue_blocks = POOL_DEFAULT_QUEUE;
+    }
+
+    if ((slots > POOL_MAX_SLOTS) || (queue_blocks > POOL_MAX_QUEUE)) {
+        return NULL;
+    }
+
+    /* the total size must not wrap around, e.g. with a 32-bit size_t */
+    slot_size = sizeof(pool_slot_t) + (queue_blocks * XXH64PRNG_OUTPUT_BYTES);
+    if (slots > ((SIZE_MAX - POOL_LINE_BYTES) / slot_size)) {
+        return NULL;
+    }
+
+    if (!(pool = (xxh64prng_pool_t*)calloc(1U, sizeof(xxh64prng_pool_t)))) {
+        return NULL;
+    }
+
+    pool->slot_count = slots;
+    pool->slot_size = slot_size;
+    pool->queue_blocks = (uint32_t)queue_blocks;
+
+    if (!(pool->memory = calloc(1U, (slots * slot_size) + POOL_LINE_BYTES))) {
+        free(pool);
+        return NULL;
+    }
+
+    pool->slots = (uint8_t*)(((uintptr_t)pool->memory + (POOL_LINE_BYTES - 1U)) & ~((uintptr_t)(POOL_LINE_BYTES - 1U)));
+
+    for (index = 0U; index < slots; ++index) {
+        pool_slot_t *const slot = POOL_SLOT(pool, index);
+        xxh64prng_derive(&slot->state, master, (uint64_t)index);
+        slot->consumer.data.pool = pool;
+        pool_produce(pool, slot, queue_blocks);
+        slot->consumer.data.local.block = (const uint64_t*)POOL_RING(slot);
+    }
+
+    if (refiller) {
+        if (!(pool->monitor = xxh64prng_os_monitor_create())) {
+            xxh64prng_pool_destroy(pool);
+            return NULL;
+        }
+        if (!(pool->refiller = xxh64prng_os_thread_create(pool_refiller_main, pool))) {
+            xxh64prng_pool_destroy(pool);
+            return NULL;
+        }
+    }
+
+    return pool;
+}
+
+/* Claim a generator for the calling thread, returns NULL if all generators are in use (does not block) */
+XXH64PRNG_API xxh64prng_local_t *xxh64prng_pool_acquire(xxh64prng_pool_t *const pool)
+{
+    size_t index;
+    for (index = 0U; index < pool->slot_count; ++index) {
+        pool_slot_t *const slot = POOL_SLOT(pool, index);
+        if ((!POOL_LOAD(&slot->owner.in_use)) && POOL_CAS(&slot->owner.in_use, 0U, 1U)) {
+            return &slot->consumer.data.local;
+        }
+    }
+    return NULL;
+}
+
+/* Return the generator to the pool, the next owner continues with the rest of its stream */
+XXH64PRNG_API void xxh64prng_pool_release(xxh64prng_local_t *const local)
+{
+    pool_slot_t *const slot = (pool_slot_t*)local;
+    POOL_STORE(&slot->owner.in_use, 0U);
+}
+
+/* Stop the refiller and release the pool, all generators must have been released */
+XXH64PRNG_API void xxh64prng_pool_destroy(xxh64prng_pool_t *const pool)
+{
+    if (!pool) {
+        return;
+    }
+
+    if (pool->refiller) {
+        xxh64prng_os_monitor_enter(pool->monitor);
+        pool->shutdown = true;
+        xxh64prng_os_monitor_notify(pool->monitor);
+        xxh64prng_os_monitor_leave(pool->monitor);
+        xxh64prng_os_thread_join(pool->refiller);
+    }
+
+    if (pool->monitor) {
+        xxh64prng_os_monitor_destroy(pool->monitor);
+    }
+
+    xxh64prng_zero(pool->slots, pool->slot_count * pool->slot_size);
+    free(pool->memory);
+    free(pool);
+}
+
+/* Fill buffer with the next "len" bytes of the generator, only the owning thread may call this */
+XXH64PRNG_API void xxh64prng_local_fill(xxh64prng_local_t *const local, void *const buf, size_t len)
+{
+    uint8_t *out = (uint8_t*)buf;
+
+    while (len > 0U) {
+        size_t chunk_size;
+        if (local->offset >= XXH64PRNG_OUTPUT_BYTES) {
+            pool_next_block((pool_slot_t*)local);
+        }
+        chunk_size = XXH64PRNG_OUTPUT_BYTES - local->offset;
+        if (chunk_size > len) {
+            chunk_size = len;
+        }
+        memcpy(out, ((const uint8_t*)local->block) + local->offset, chunk_size);
+        local->offset += chunk_size;
+        out += chunk_size;
+        len -= chunk_size;
+    }
+}
@@ -0,0 +1,585 @@
+/*
+ * XXH64-PRNG
+ * Blazing fast XXH64-based secure pseudo-random number generator
+ *
+ * Copyright (c) 2025 "dEajL3kA" <Cumpoing79@web.de>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * https://www.opensource.org/licenses/bsd-license.php
+ */
+
+#include "xxh64_simd.h"
+#include "xxh64.h"
+#include <string.h>
+
+#if defined(__GNUC__) || defined(__clang__)
+#  define XXH_FORCE_INLINE static __inline__ __attribute__((__always_inline__, __unused__))
+#elif defined(_MSC_VER)
+#  define XXH_FORCE_INLINE static __forceinline
+#else
+#  define XXH_FORCE_INLINE static inline
+#endif
+
+#define XXH_PRIME64_1 UINT64_C(0x9E3779B185EBCA87)
+#define XXH_PRIME64_2 UINT64_C(0xC2B2AE3D27D4EB4F)
+#define XXH_PRIME64_3 UINT64_C(0x165667B19E3779F9)
+#define XXH_PRIME64_4 UINT64_C(0x85EBCA77C2B2AE63)
+
+/* All lanes hash exactly this many bytes */
+#define XXH_INPUT_WORDS _XXH64PRNG_STATE_WORDS
+#define XXH_INPUT_BYTES _XXH64PRNG_STATE_BYTES
+
+/*
+ * Since all lanes hash the same message, the "input * PRIME64_2" term of each
+ * round is lane-invariant and computed only once per call.
+ */
+XXH_FORCE_INLINE void XXH64_multiseed_prepare(uint64_t *const k, const uint64_t *const input)
+{
+    size_t pos;
+    for (pos = 0U; pos < XXH_INPUT_WORDS; ++pos) {
+        k[pos] = input[pos] * XXH_PRIME64_2;
+    }
+}
+
+/* ======================================================================== */
+/* Scalar                                                                   */
+/* ======================================================================== */
+
+#if defined(_MSC_VER)
+#  define XXH_rotl64 _rotl64
+#else
+#  define XXH_rotl64(x,r) (((x) << (r)) | ((x) >> (64 - (r))))
+#endif
+
+static void XXH64_multiseed_scalar(const uint64_t *const input, const void *const seed, void *const out, const size_t count)
+{
+    const uint8_t *src = (const uint8_t*)seed;
+    uint8_t *dst = (uint8_t*)out;
+    uint64_t value;
+    size_t pos;
+    for (pos = 0U; pos < count; ++pos, src += sizeof(uint64_t), dst += sizeof(uint64_t)) {
+        memcpy(&value, src, sizeof(uint64_t));
+        value = XXH64(input, XXH_INPUT_BYTES, value);
+        memcpy(dst, &value, sizeof(uint64_t));
+    }
+}
+
+/* Out-of-order execution overlaps the independent hashes, only the "input * PRIME64_2" terms are precomputed */
+static void XXH64_multistate_scalar(const uint64_t *const input, const uint64_t *const seed, uint64_t *const out, const size_t lanes, const size_t count)
+{
+    uint64_t k[XXH_INPUT_WORDS], acc[4], h;
+    size_t lane, pos, i;
+
+    for (lane = 0U; lane < lanes; ++lane) {
+        for (i = 0U; i < XXH_INPUT_WORDS; ++i) {
+            k[i] = input[(i * lanes) + lane] * XXH_PRIME64_2;
+        }
+        for (pos = 0U; pos < count; ++pos) {
+            const uint64_t s = seed[(pos * lanes) + lane];
+            acc[0] = s + XXH_PRIME64_1 + XXH_PRIME64_2;
+            acc[1] = s + XXH_PRIME64_2;
+            acc[2] = s;
+            acc[3] = s - XXH_PRIME64_1;
+            for (i = 0U; i < XXH_INPUT_WORDS; ++i) {
+                acc[i & 3U] = XXH_rotl64(acc[i & 3U] + k[i], 31) * XXH_PRIME64_1;
+            }
+            h = XXH_rotl64(acc[0], 1) + XXH_rotl64(acc[1], 7) + XXH_rotl64(acc[2], 12) + XXH_rotl64(acc[3], 18);
+            for (i = 0U; i < 4U; ++i) {
+                h = ((h ^ (XXH_rotl64(acc[i] * XXH_PRIME64_2, 31) * XXH_PRIME64_1)) * XXH_PRIME64_1) + XXH_PRIME64_4;
+            }
+            h += XXH_INPUT_BYTES;
+            h = (h ^ (h >> 33)) * XXH_PRIME64_2;
+            h = (h ^ (h >> 29)) * XXH_PRIME64_3;
+            out[(pos * lanes) + lane] = h ^ (h >> 32);
+        }
+    }
+}
+
+/* ======================================================================== */
+/* x86: AVX2 (4 lanes)                                                      */
+/* ======================================================================== */
+
+#if XXH_SIMD_X86
+
+#define XXH_mm256_rotl64(X, R) _mm256_or_si256(_mm256_slli_epi64((X), (R)), _mm256_srli_epi64((X), 64 - (R)))
+
+/* AVX2 has no 64-bit "mullo", so it is emulated with three 32x32->64 multiplies */
+XXH_TARGET_AVX2 XXH_FORCE_INLINE __m256i XXH_mm256_mul64(const __m256i a, const __m256i b_lo, const __m256i b_hi)
+{
+    const __m256i lo = _mm256_mul_epu32(a, b_lo);
+    const __m256i cross = _mm256_add_epi64(_mm256_mul_epu32(_mm256_srli_epi64(a, 32), b_lo), _mm256_mul_epu32(a, b_hi));
+    return _mm256_add_epi64(lo, _mm256_slli_epi64(cross, 32));
+}
+
+/* Computes XXH64 of the 64-byte message "k / PRIME64_2" with the seed "s", in each lane */
+XXH_TARGET_AVX2 XXH_FORCE_INLINE __m256i XXH64_avx2_hash(const __m256i *const k, const __m256i s)
+{
+    const __m256i p1 = _mm256_set1_epi64x((long long)XXH_PRIME64_1), p1_hi = _mm256_set1_epi64x((long long)(XXH_PRIME64_1 >> 32));
+    const __m256i p2 = _mm256_set1_epi64x((long long)XXH_PRIME64_2), p2_hi = _mm256_set1_epi64x((long long)(XXH_PRIME64_2 >> 32));
+    const __m256i p3 = _mm256_set1_epi64x((long long)XXH_PRIME64_3), p3_hi = _mm256_set1_epi64x((long long)(XXH_PRIME64_3 >> 32));
+    const __m256i p4 = _mm256_set1_epi64x((long long)XXH_PRIME64_4);
+    const __m256i p1p2 = _mm256_set1_epi64x((long long)(XXH_PRIME64_1 + XXH_PRIME64_2));
+    const __m256i len = _mm256_set1_epi64x((long long)XXH_INPUT_BYTES);
+    __m256i acc[4], h, v;
+    size_t i;
+
+    acc[0] = _mm256_add_epi64(s, p1p2);
+    acc[1] = _mm256_add_epi64(s, p2);
+    acc[2] = s;
+    acc[3] = _mm256_sub_epi64(s, p1);
+    for (i = 0U; i < XXH_INPUT_WORDS; ++i) {
+        v = _mm256_add_epi64(acc[i & 3U], k[i]);
+        acc[i & 3U] = XXH_mm256_mul64(XXH_mm256_rotl64(v, 31), p1, p1_hi);
+    }
+    h = _mm256_add_epi64(_mm256_add_epi64(XXH_mm256_rotl64(acc[0], 1), XXH_mm256_rotl64(acc[1], 7)), _mm256_add_epi64(XXH_mm256_rotl64(acc[2], 12), XXH_mm256_rotl64(acc[3], 18)));
+    for (i = 0U; i < 4U; ++i) {
+        v = XXH_mm256_mul64(XXH_mm256_rotl64(XXH_mm256_mul64(acc[i], p2, p2_hi), 31), p1, p1_hi);
+        h = _mm256_add_epi64(XXH_mm256_mul64(_mm256_xor_si256(h, v), p1, p1_hi), p4);
+    }
+    h = _mm256_add_epi64(h, len);
+    h = XXH_mm256_mul64(_mm256_xor_si256(h, _mm256_srli_epi64(h, 33)), p2, p2_hi);
+    h = XXH_mm256_mul64(_mm256_xor_si256(h, _mm256_srli_epi64(h, 29)), p3, p3_hi);
+    return _mm256_xor_si256(h, _mm256_srli_epi64(h, 32));
+}
+
+XXH_TARGET_AVX2 static void XXH64_multiseed_avx2(const uint64_t *const input, const void *const seed, void *const out, const size_t count)
+{
+    uint64_t k_scalar[XXH_INPUT_WORDS];
+    __m256i k[XXH_INPUT_WORDS];
+    const uint8_t *const src = (const uint8_t*)seed;
+    uint8_t *const dst = (uint8_t*)out;
+    size_t pos, i;
+
+    XXH64_multiseed_prepare(k_scalar, input);
+    for (i = 0U; i < XXH_INPUT_WORDS; ++i) {
+        k[i] = _mm256_set1_epi64x((long long)k_scalar[i]);
+    }
+
+    for (pos = 0U; pos + 4U <= count; pos += 4U) {
+        const __m256i s = _mm256_loadu_si256((const __m256i*)(src + sizeof(uint64_t) * pos));
+        _mm256_storeu_si256((__m256i*)(dst + sizeof(uint64_t) * pos), XXH64_avx2_hash(k, s));
+    }
+
+    if (pos < count) {
+        XXH64_multiseed_scalar(input, src + sizeof(uint64_t) * pos, dst + sizeof(uint64_t) * pos, count - pos);
+    }
+}
+
+XXH_TARGET_AVX2 static void XXH64_multistate_avx2(const uint64_t *const input, const uint64_t *const seed, uint64_t *const out, const size_t lanes, const size_t count)
+{
+    const __m256i p2 = _mm256_set1_epi64x((long long)XXH_PRIME64_2), p2_hi = _mm256_set1_epi64x((long long)(XXH_PRIME64_2 >> 32));
+    __m256i k[XXH_INPUT_WORDS];
+    size_t lane, pos, i;
+
+    for (lane = 0U; lane < lanes; lane += 4U) {
+        for (i = 0U; i < XXH_INPUT_WORDS; ++i) {
+            k[i] = XXH_mm256_mul64(_mm256_loadu_si256((const __m256i*)(input + (i * lanes) + lane)), p2, p2_hi);
+        }
+        for (pos = 0U; pos < count; ++pos) {
+            const __m256i s = _mm256_loadu_si256((const __m256i*)(seed + (pos * lanes) + lane));
+            _mm256_storeu_si256((__m256i*)(out + (pos * lanes) + lane), XXH64_avx2_hash(k, s));
+        }
+    }
+}
+
+/* Transpose a 4x4 matrix of words, afterwards row j holds word j of each of the 4 lanes */
+XXH_TARGET_AVX2 XXH_FORCE_INLINE void XXH_mm256_transpose4(__m256i *const r)
+{
+    const __m256i t0 = _mm256_unpacklo_epi64(r[0], r[1]);
+    const __m256i t1 = _mm256_unpackhi_epi64(r[0], r[1]);
+    const __m256i t2 = _mm256_unpacklo_epi64(r[2], r[3]);
+    const __m256i t3 = _mm256_unpackhi_epi64(r[2], r[3]);
+    r[0] = _mm256_permute2x128_si256(t0, t2, 0x20);
+    r[1] = _mm256_permute2x128_si256(t1, t3, 0x20);
+    r[2] = _mm256_permute2x128_si256(t0, t2, 0x31);
+    r[3] = _mm256_permute2x128_si256(t1, t3, 0x31);
+}
+
+/* ======================================================================== */
+/* x86: AVX-512 (8 lanes)                                                   */
+/* ======================================================================== */
+
+/* Computes XXH64 of the 64-byte message "k / PRIME64_2" with the seed "s", in each lane */
+XXH_TARGET_AVX512 XXH_FORCE_INLINE __m512i XXH64_avx512_hash(const __m512i *const k, const __m512i s)
+{
+    const __m512i p1 = _mm512_set1_epi64((long long)XXH_PRIME64_1);
+    const __m512i p2 = _mm512_set1_epi64((long long)XXH_PRIME64_2);
+    const __m512i p3 = _mm512_set1_epi64((long long)XXH_PRIME64_3);
+    const __m512i p4 = _mm512_set1_epi64((long long)XXH_PRIME64_4);
+    const __m512i p1p2 = _mm512_set1_epi64((long long)(XXH_PRIME64_1 + XXH_PRIME64_2));
+    const __m512i len = _mm512_set1_epi64((long long)XXH_INPUT_BYTES);
+    __m512i acc[4], h, v;
+    size_t i;
+
+    acc[0] = _mm512_add_epi64(s, p1p2);
+    acc[1] = _mm512_add_epi64(s, p2);
+    acc[2] = s;
+    acc[3] = _mm512_sub_epi64(s, p1);
+    for (i = 0U; i < XXH_INPUT_WORDS; ++i) {
+        v = _mm512_add_epi64(acc[i & 3U], k[i]);
+        acc[i & 3U] = _mm512_mullo_epi64(_mm512_rol_epi64(v, 31), p1);
+    }
+    h = _mm512_add_epi64(_mm512_add_epi64(_mm512_rol_epi64(acc[0], 1), _mm512_rol_epi64(acc[1], 7)), _mm512_add_epi64(_mm512_rol_epi64(acc[2], 12), _mm512_rol_epi64(acc[3], 18)));
+    for (i = 0U; i < 4U; ++i) {
+        v = _mm512_mullo_epi64(_mm512_rol_epi64(_mm512_mullo_epi64(acc[i], p2), 31), p1);
+        h = _mm512_add_epi64(_mm512_mullo_epi64(_mm512_xor_si512(h, v), p1), p4);
+    }
+    h = _mm512_add_epi64(h, len);
+    h = _mm512_mullo_epi64(_mm512_xor_si512(h, _mm512_srli_epi64(h, 33)), p2);
+    h = _mm512_mullo_epi64(_mm512_xor_si512(h, _mm512_srli_epi64(h, 29)), p3);
+    return _mm512_xor_si512(h, _mm512_srli_epi64(h, 32));
+}
+
+XXH_TARGET_AVX512 static void XXH64_multiseed_avx512(const uint64_t *const input, const void *const seed, void *const out, const size_t count)
+{
+    uint64_t k_scalar[XXH_INPUT_WORDS];
+    __m512i k[XXH_INPUT_WORDS];
+    const uint8_t *const src = (const uint8_t*)seed;
+    uint8_t *const dst = (uint8_t*)out;
+    size_t pos, i;
+
+    XXH64_multiseed_prepare(k_scalar, input);
+    for (i = 0U; i < XXH_INPUT_WORDS; ++i) {
+        k[i] = _mm512_set1_epi64((long long)k_scalar[i]);
+    }
+
+    for (pos = 0U; pos + 8U <= count; pos += 8U) {
+        const __m512i s = _mm512_loadu_si512((const void*)(src + sizeof(uint64_t) * pos));
+        _mm512_storeu_si512((void*)(dst + sizeof(uint64_t) * pos), XXH64_avx512_hash(k, s));
+    }
+
+    if (pos < count) {
+        XXH64_multiseed_scalar(input, src + sizeof(uint64_t) * pos, dst + sizeof(uint64_t) * pos, count - pos);
+    }
+}
+
+/* Only 8 lanes fill a 512-Bit vector, 4 lanes are left to the AVX2 kernel */
+XXH_TARGET_AVX512 static void XXH64_multistate_avx512(const uint64_t *const input, const uint64_t *const seed, uint64_t *const out, const size_t lanes, const size_t count)
+{
+    const __m512i p2 = _mm512_set1_epi64((long long)XXH_PRIME64_2);
+    __m512i k[XXH_INPUT_WORDS];
+    size_t pos, i;
+
+    if (lanes != 8U) {
+        XXH64_multistate_avx2(input, seed, out, lanes, count);
+        return;
+    }
+
+    for (i = 0U; i < XXH_INPUT_WORDS; ++i) {
+        k[i] = _mm512_mullo_epi64(_mm512_loadu_si512((const void*)(input + (i * 8U))), p2);
+    }
+    for (pos = 0U; pos < count; ++pos) {
+        const __m512i s = _mm512_loadu_si512((const void*)(seed + (pos * 8U)));
+        _mm512_storeu_si512((void*)(out + (pos * 8U)), XXH64_avx512_hash(k, s));
+    }
+}
+
+/* The two halves of each row are transposed separately, as 4x4 matrices */
+XXH_TARGET_AVX512 static void XXH64_stripes_avx512(uint64_t *const acc, const uint8_t *const *const input, const size_t lanes, const size_t stripes)
+{
+    const __m512i p1 = _mm512_set1_epi64((long long)XXH_PRIME64_1);
+    const __m512i p2 = _mm512_set1_epi64((long long)XXH_PRIME64_2);
+    __m512i v[4];
+    __m256i lo[4], hi[4];
+    size_t lane, pos, j;
+
+    for (lane = 0U; lane < lanes; lane += 8U) {
+        for (j = 0U; j < 4U; ++j) {
+            v[j] = _mm512_loadu_si512((const void*)(acc + (j * lanes) + lane));
+        }
+        for (pos = 0U; pos < stripes; ++pos) {
+            for (j = 0U; j < 4U; ++j) {
+                lo[j] = _mm256_loadu_si256((const __m256i*)(input[lane + j] + (pos * 32U)));
+                hi[j] = _mm256_loadu_si256((const __m256i*)(input[lane + j + 4U] + (pos * 32U)));
+            }
+            XXH_mm256_transpose4(lo);
+            XXH_mm256_transpose4(hi);
+            for (j = 0U; j < 4U; ++j) {
+                const __m512i w = _mm512_inserti64x4(_mm512_castsi256_si512(lo[j]), hi[j], 1);
+                v[j] = _mm512_mullo_epi64(_mm512_rol_epi64(_mm512_add_epi64(v[j], _mm512_mullo_epi64(w, p2)), 31), p1);
+            }
+        }
+        for (j = 0U; j < 4U; ++j) {
+            _mm512_storeu_si512((void*)(acc + (j * lanes) + lane), v[j]);
+        }
+    }
+}
+
+#endif /*XXH_SIMD_X86*/
+
+/* ======================================================================== */
+/* ARM64: NEON (2x2 lanes)                                                  */
+/* ======================================================================== */
+
+#if XXH_SIMD_NEON
+
+#define XXH_vrotlq_u64(X, R) vsriq_n_u64(vshlq_n_u64((X), (R)), (X), 64 - (R))
+
+/* NEON has no 64-bit vector multiply; the cross terms only matter modulo 2^32 */
+XXH_FORCE_INLINE uint64x2_t XXH_vmulq_u64(const uint64x2_t a, const uint32x2_t b_lo, const uint32x2_t b_hi)
+{
+    const uint32x2_t a_lo = vmovn_u64(a);
+    const uint32x2_t a_hi = vshrn_n_u64(a, 32);
+    const uint32x2_t cross = vmla_u32(vmul_u32(a_hi, b_lo), a_lo, b_hi);
+    return vaddq_u64(vmull_u32(a_lo, b_lo), vshlq_n_u64(vmovl_u32(cross), 32));
+}
+
+typedef struct {
+    uint32x2_t p1_lo, p1_hi, p2_lo, p2_hi, p3_lo, p3_hi;
+    uint64x2_t p1, p2, p4, p1p2, len, k[XXH_INPUT_WORDS];
+} XXH_neon_const_t;
+
+/* Computes XXH64 of the 64-byte message "k / PRIME64_2" with the seed "s", in each lane */
+XXH_FORCE_INLINE uint64x2_t XXH64_neon_hash(const XXH_neon_const_t *const c, const uint64x2_t *const k, const uint64x2_t s)
+{
+    uint64x2_t acc[4], h, v;
+    size_t i;
+
+    acc[0] = vaddq_u64(s, c->p1p2);
+    acc[1] = vaddq_u64(s, c->p2);
+    acc[2] = s;
+    acc[3] = vsubq_u64(s, c->p1);
+    for (i = 0U; i < XXH_INPUT_WORDS; ++i) {
+        v = vaddq_u64(acc[i & 3U], k[i]);
+        acc[i & 3U] = XXH_vmulq_u64(XXH_vrotlq_u64(v, 31), c->p1_lo, c->p1_hi);
+    }
+    h = vaddq_u64(vaddq_u64(XXH_vrotlq_u64(acc[0], 1), XXH_vrotlq_u64(acc[1], 7)), vaddq_u64(XXH_vrotlq_u64(acc[2], 12), XXH_vrotlq_u64(acc[3], 18)));
+    for (i = 0U; i < 4U; ++i) {
+        v = XXH_vmulq_u64(XXH_vrotlq_u64(XXH_vmulq_u64(acc[i], c->p2_lo, c->p2_hi), 31), c->p1_lo, c->p1_hi);
+        h = vaddq_u64(XXH_vmulq_u64(veorq_u64(h, v), c->p1_lo, c->p1_hi), c->p4);
+    }
+    h = vaddq_u64(h, c->len);
+    h = XXH_vmulq_u64(veorq_u64(h, vshrq_n_u64(h, 33)), c->p2_lo, c->p2_hi);
+    h = XXH_vmulq_u64(veorq_u64(h, vshrq_n_u64(h, 29)), c->p3_lo, c->p3_hi);
+    return veorq_u64(h, vshrq_n_u64(h, 32));
+}
+
+static void XXH64_neon_setup(XXH_neon_const_t *const c)
+{
+    c->p1_lo = vdup_n_u32((uint32_t)XXH_PRIME64_1); c->p1_hi = vdup_n_u32((uint32_t)(XXH_PRIME64_1 >> 32));
+    c->p2_lo = vdup_n_u32((uint32_t)XXH_PRIME64_2); c->p2_hi = vdup_n_u32((uint32_t)(XXH_PRIME64_2 >> 32));
+    c->p3_lo = vdup_n_u32((uint32_t)XXH_PRIME64_3); c->p3_hi = vdup_n_u32((uint32_t)(XXH_PRIME64_3 >> 32));
+    c->p1 = vdupq_n_u64(XXH_PRIME64_1);
+    c->p2 = vdupq_n_u64(XXH_PRIME64_2);
+    c->p4 = vdupq_n_u64(XXH_PRIME64_4);
+    c->p1p2 = vdupq_n_u64(XXH_PRIME64_1 + XXH_PRIME64_2);
+    c->len = vdupq_n_u64((uint64_t)XXH_INPUT_BYTES);
+}
+
+static void XXH64_multiseed_neon(const uint64_t *const input, const void *const seed, void *const out, const size_t count)
+{
+    XXH_neon_const_t c;
+    uint64_t k_scalar[XXH_INPUT_WORDS];
+    const uint8_t *const src = (const uint8_t*)seed;
+    uint8_t *const dst = (uint8_t*)out;
+    size_t pos, i;
+
+    XXH64_neon_setup(&c);
+
+    XXH64_multiseed_prepare(k_scalar, input);
+    for (i = 0U; i < XXH_INPUT_WORDS; ++i) {
+        c.k[i] = vdupq_n_u64(k_scalar[i]);
+    }
+
+    for (pos = 0U; pos + 4U <= count; pos += 4U) {
+        const uint64x2_t h0 = XXH64_neon_hash(&c, c.k, vreinterpretq_u64_u8(vld1q_u8(src + sizeof(uint64_t) * pos)));
+        const uint64x2_t h1 = XXH64_neon_hash(&c, c.k, vreinterpretq_u64_u8(vld1q_u8(src + sizeof(uint64_t) * (pos + 2U))));
+        vst1q_u8(dst + sizeof(uint64_t) * pos, vreinterpretq_u8_u64(h0));
+        vst1q_u8(dst + sizeof(uint64_t) * (pos + 2U), vreinterpretq_u8_u64(h1));
+    }
+
+    if (pos < count) {
+        XXH64_multiseed_scalar(input, src + sizeof(uint64_t) * pos, dst + sizeof(uint64_t) * pos, count - pos);
+    }
+}
+
+/* Two lanes per vector, always processed in pairs of vectors */
+static void XXH64_multistate_neon(const uint64_t *const input, const uint64_t *const seed, uint64_t *const out, const size_t lanes, const size_t count)
+{
+    XXH_neon_const_t c;
+    uint64x2_t k0[XXH_INPUT_WORDS], k1[XXH_INPUT_WORDS];
+    size_t lane, pos, i;
+
+    XXH64_neon_setup(&c);
+
+    for (lane = 0U; lane < lanes; lane += 4U) {
+        for (i = 0U; i < XXH_INPUT_WORDS; ++i) {
+            k0[i] = XXH_vmulq_u64(vld1q_u64(input + (i * lanes) + lane), c.p2_lo, c.p2_hi);
+            k1[i] = XXH_vmulq_u64(vld1q_u64(input + (i * lanes) + lane + 2U), c.p2_lo, c.p2_hi);
+        }
+        for (pos = 0U; pos < count; ++pos) {
+            const uint64x2_t h0 = XXH64_neon_hash(&c, k0, vld1q_u64(seed + (pos * lanes) + lane));
+            const uint64x2_t h1 = XXH64_neon_hash(&c, k1, vld1q_u64(seed + (pos * lanes) + lane + 2U));
+            vst1q_u64(out + (pos * lanes) + lane, h0);
+            vst1q_u64(out + (pos * lanes) + lane + 2U, h1);
+        }
+    }
+}
+
+#endif /*XXH_SIMD_NEON*/
+
+/* ======================================================================== */
+/* CPU detection                                                            */
+/* ======================================================================== */
+
+#if XXH_SIMD_X86
+
+static void XXH_cpuid(const uint32_t leaf, const uint32_t subleaf, uint32_t *const regs)
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    int info[4];
+    __cpuidex(info, (int)leaf, (int)subleaf);
+    regs[0] = (uint32_t)info[0]; regs[1] = (uint32_t)info[1]; regs[2] = (uint32_t)info[2]; regs[3] = (uint32_t)info[3];
+#else
+    __cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+#endif
+}
+
+static uint64_t XXH_xgetbv(void)
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    return (uint64_t)_xgetbv(0U);
+#else
+    uint32_t eax, edx;
+    __asm__ __volatile__ (".byte 0x0f, 0x01, 0xd0" : "=a"(eax), "=d"(edx) : "c"(0U));
+    return (((uint64_t)edx) << 32) | eax;
+#endif
+}
+
+XXH64PRNG_API int XXH_cpu_features(void)
+{
+    uint32_t regs[4], max_leaf;
+    uint64_t xcr0;
+    int features = 0;
+
+    XXH_cpuid(0U, 0U, regs);
+    if ((max_leaf = regs[0]) < 1U) {
+        return 0;
+    }
+
+    XXH_cpuid(1U, 0U, regs);
+    if (regs[2] & (UINT32_C(1) << 9)) {
+        features |= XXH_CPU_SSSE3;
+    }
+
+    if ((max_leaf < 7U) || ((regs[2] & (UINT32_C(1) << 27)) == 0U)) {
+        return features; /* OSXSAVE not set */
+    }
+
+    xcr0 = XXH_xgetbv();
+    XXH_cpuid(7U, 0U, regs);
+
+    if (((xcr0 & 0x06U) == 0x06U) && (regs[1] & (UINT32_C(1) << 5))) {
+        features |= XXH_CPU_AVX2;
+        if (((xcr0 & 0xE0U) == 0xE0U) && (regs[1] & (UINT32_C(1) << 16)) && (regs[1] & (UINT32_C(1) << 17))) {
+            features |= XXH_CPU_AVX512;
+        }
+    }
+
+    return features;
+}
+
+#endif /*XXH_SIMD_X86*/
+
+/* ======================================================================== */
+/* Kernel selection                                                         */
+/* ======================================================================== */
+
+XXH64PRNG_API xxh64_multiseed_t XXH64_multiseed_kernel(const xxh64prng_impl_t impl)
+{
+    switch (impl) {
+    case XXH64PRNG_IMPL_AUTO:
+        return XXH64_multiseed_kernel(XXH64_multiseed_detect());
+    case XXH64PRNG_IMPL_SCALAR:
+        return XXH64_multiseed_scalar;
+#if XXH_SIMD_X86
+    case XXH64PRNG_IMPL_AVX2:
+        return (XXH_cpu_features() & XXH_CPU_AVX2) ? XXH64_multiseed_avx2 : NULL;
+    case XXH64PRNG_IMPL_AVX512:
+        return (XXH_cpu_features() & XXH_CPU_AVX512) ? XXH64_multiseed_avx512 : NULL;
+#endif
+#if XXH_SIMD_NEON
+    case XXH64PRNG_IMPL_NEON:
+        return XXH64_multiseed_neon;
+#endif
+    default:
+        return NULL;
+    }
+}
+
+XXH64PRNG_API xxh64_multistate_t XXH64_multistate_kernel(const xxh64prng_impl_t impl)
+{
+    switch (impl) {
+    case XXH64PRNG_IMPL_AUTO:
+        return XXH64_multistate_kernel(XXH64_multiseed_detect());
+    case XXH64PRNG_IMPL_SCALAR:
+        return XXH64_multistate_scalar;
+#if XXH_SIMD_X86
+    case XXH64PRNG_IMPL_AVX2:
+        return (XXH_cpu_features() & XXH_CPU_AVX2) ? XXH64_multistate_avx2 : NULL;
+    case XXH64PRNG_IMPL_AVX512:
+        return (XXH_cpu_features() & XXH_CPU_AVX512) ? XXH64_multistate_avx512 : NULL;
+#endif
+#if XXH_SIMD_NEON
+    case XXH64PRNG_IMPL_NEON:
+        return XXH64_multistate_neon;
+#endif
+    default:
+        return NULL;
+    }
+}
+
+/*
+ * Without a 64-bit vector multiply, the scalar XXH64 loop (four independent
+ * accumulators already) is faster than interleaving buffers, so only AVX-512
+ * has a multi-buffer kernel.
+ */
+XXH64PRNG_API xxh64_stripes_t XXH64_stripes_kernel(const xxh64prng_impl_t impl)
+{
+    switch (impl) {
+    case XXH64PRNG_IMPL_AUTO:
+        return XXH64_stripes_kernel(XXH64_multiseed_detect());
+#if XXH_SIMD_X86
+    case XXH64PRNG_IMPL_AVX512:
+        return (XXH_cpu_features() & XXH_CPU_AVX512) ? XXH64_stripes_avx512 : NULL;
+#endif
+    default:
+        return NULL;
+    }
+}
+
+XXH64PRNG_API xxh64prng_impl_t XXH64_multiseed_detect(void)
+{
+#if XXH_SIMD_X86
+    const int features = XXH_cpu_features();
+    if (features & XXH_CPU_AVX512) {
+        return XXH64PRNG_IMPL_AVX512;
+    }
+    if (features & XXH_CPU_AVX2) {
+        return XXH64PRNG_IMPL_AVX2;
+    }
+#elif XXH_SIMD_NEON
+    return XXH64PRNG_IMPL_NEON;
+#endif
+    return XXH64PRNG_IMPL_SCALAR;
+}
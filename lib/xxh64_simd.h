@@ -0,0 +1,120 @@
+/*
+ * XXH64-PRNG
+ * Blazing fast XXH64-based secure pseudo-random number generator
+ *
+ * Copyright (c) 2025 "dEajL3kA" <Cumpoing79@web.de>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * https://www.opensource.org/licenses/bsd-license.php
+ */
+
+#ifndef _XXH64_SIMD_H
+#define _XXH64_SIMD_H
+
+#include <xxh64_prng.h>
+
+/* SIMD support: x86 kernels are enabled per function, so no special compiler flags are required */
+#if defined(_M_X64) || defined(__x86_64__) || defined(__amd64__) || defined(_M_IX86) || defined(__i386__)
+#  if defined(_MSC_VER) && !defined(__clang__) && (_MSC_VER >= 1910)
+#    define XXH_SIMD_X86 1
+#    define XXH_TARGET_SSSE3
+#    define XXH_TARGET_AVX2
+#    define XXH_TARGET_AVX512
+#    include <intrin.h>
+#    include <immintrin.h>
+#  elif (defined(__GNUC__) && (__GNUC__ >= 5)) || defined(__clang__)
+#    define XXH_SIMD_X86 1
+#    define XXH_TARGET_SSSE3 __attribute__((__target__("ssse3")))
+#    define XXH_TARGET_AVX2 __attribute__((__target__("avx2")))
+#    define XXH_TARGET_AVX512 __attribute__((__target__("avx512f,avx512dq")))
+#    include <cpuid.h>
+#    include <immintrin.h>
+#  endif
+#elif defined(_M_ARM64) || defined(__aarch64__)
+#  define XXH_SIMD_NEON 1
+#  include <arm_neon.h>
+#endif
+
+#ifndef XXH_SIMD_X86
+#define XXH_SIMD_X86 0
+#endif
+#ifndef XXH_SIMD_NEON
+#define XXH_SIMD_NEON 0
+#endif
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*
+ * Computes out[i] = XXH64(input, 64, seed[i]) for i in [0, count).
+ *
+ * The input is always exactly _XXH64PRNG_STATE_BYTES (64) bytes, so all lanes
+ * share the same message words and differ only in their seed. The "seed" and
+ * "out" arrays need not be aligned, and "out" may alias "seed".
+ */
+typedef void (*xxh64_multiseed_t)(const uint64_t *const input, const void *const seed, void *const out, const size_t count);
+
+/*
+ * Computes out[j][l] = XXH64(input[l], 64, seed[j][l]) for j in [0, count) and
+ * l in [0, lanes), where "lanes" is either 4 or 8.
+ *
+ * This is the transposed variant, for advancing independent states together:
+ * every lane hashes its own message. All arrays use the "structure of arrays"
+ * layout, e.g. word i of the message of lane l is at input[i * lanes + l], so
+ * each row is one vector. The "out" array may alias "seed".
+ */
+typedef void (*xxh64_multistate_t)(const uint64_t *const input, const uint64_t *const seed, uint64_t *const out, const size_t lanes, const size_t count);
+
+/*
+ * Multi-buffer kernel: runs the XXH64 main loop over the first "stripes" 32-byte
+ * stripes of "lanes" independent inputs, where "lanes" is a multiple of 8. The
+ * accumulators use the "structure of arrays" layout, i.e. accumulator j of lane
+ * l is at acc[j * lanes + l]. The inputs may be unaligned.
+ */
+typedef void (*xxh64_stripes_t)(uint64_t *const acc, const uint8_t *const *const input, const size_t lanes, const size_t stripes);
+
+/* Returns the kernel for the given implementation, or NULL if not supported */
+XXH64PRNG_API xxh64_multiseed_t XXH64_multiseed_kernel(const xxh64prng_impl_t impl);
+XXH64PRNG_API xxh64_multistate_t XXH64_multistate_kernel(const xxh64prng_impl_t impl);
+
+/* Returns the multi-buffer kernel for the given implementation, or NULL if buffers are best hashed one by one */
+XXH64PRNG_API xxh64_stripes_t XXH64_stripes_kernel(const xxh64prng_impl_t impl);
+
+/* Returns the fastest implementation supported by the CPU */
+XXH64PRNG_API xxh64prng_impl_t XXH64_multiseed_detect(void);
+
+#if XXH_SIMD_X86
+#define XXH_CPU_AVX2   0x1
+#define XXH_CPU_AVX512 0x2
+#define XXH_CPU_SSSE3  0x4
+
+/* Returns the XXH_CPU_* features supported by the CPU and the OS */
+XXH64PRNG_API int XXH_cpu_features(void);
+#endif
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /*_XXH64_SIMD_H*/
@@ -30,14 +30,75 @@ run_test_case() {
 	fi
 }
 
+run_splice_case() {
+	if ! command -v python3 >/dev/null 2>&1; then
+		printf "Skipped: splice test (python3 not found)\n\n"
+		return 0
+	fi
+	echo "Computing checksum (spliced), please wait..."
+	digest=`bin/xxh_rand $3 -- $1 1073741824 | python3 test/splice_reader.py | $sha512cmd | cut -d' ' -f1`
+	if [ "$digest" != "$2" ]; then
+		echo "Test has failed: Checksum mismatch error !!!"
+		printf "> computed: %s\n> expected: %s\n\n" "$digest" "$2"
+		exit 1
+	else
+		printf "Success.\n\n"
+	fi
+}
+
+run_resume_case() {
+	echo "Computing checksum (resumed), please wait..."
+	tmpdir=`mktemp -d -t run_tests-XXXXX`
+	if [ -n "$4" ]; then
+		bin/xxh_rand $3 $5 --save-state "$tmpdir/state" --output "$tmpdir/output" -- $1 1073741824 &
+		sleep $4
+		kill -TERM $! 2>/dev/null || true
+		wait $! || true
+	else
+		bin/xxh_rand $3 $5 --save-state "$tmpdir/state" --output "$tmpdir/output" -- $1 500000001
+	fi
+	bin/xxh_rand $3 --resume "$tmpdir/state" --output "$tmpdir/output" - 1073741824
+	digest=`$sha512cmd < "$tmpdir/output" | cut -d' ' -f1`
+	rm -rf "$tmpdir"
+	if [ "$digest" != "$2" ]; then
+		echo "Test has failed: Checksum mismatch error !!!"
+		printf "> computed: %s\n> expected: %s\n\n" "$digest" "$2"
+		exit 1
+	else
+		printf "Success.\n\n"
+	fi
+}
+
 bin/xxh_rand --version
 printf "Git: %s\n\n" "`git describe --dirty`"
 
 run_test_case 1 c3b859699c69271ac8c28dfeef270b336dfde71b9c9c441b6364a189baa9710b231f950cb5663bdf2f58a9c07ad7a411783082a5e7711b08544fa7333b32210a
 run_test_case 2 397c3f14b786b1256faa16f8805584ccbf879370d57fc1561de43eb623677dfae35017440e71591f99f69a0cdbf9b7d8eab5e4c68ab2fda0a7e048d2b2204c1a
 
+run_test_case 1 c3b859699c69271ac8c28dfeef270b336dfde71b9c9c441b6364a189baa9710b231f950cb5663bdf2f58a9c07ad7a411783082a5e7711b08544fa7333b32210a "--threads 4"
+run_test_case 2 397c3f14b786b1256faa16f8805584ccbf879370d57fc1561de43eb623677dfae35017440e71591f99f69a0cdbf9b7d8eab5e4c68ab2fda0a7e048d2b2204c1a "--threads 4"
+run_test_case 1 c3b859699c69271ac8c28dfeef270b336dfde71b9c9c441b6364a189baa9710b231f950cb5663bdf2f58a9c07ad7a411783082a5e7711b08544fa7333b32210a "--async 4"
+run_test_case 1 c3b859699c69271ac8c28dfeef270b336dfde71b9c9c441b6364a189baa9710b231f950cb5663bdf2f58a9c07ad7a411783082a5e7711b08544fa7333b32210a "--vmsplice"
+
+if [ "`uname -s`" = "Linux" ]; then
+	run_splice_case 1 c3b859699c69271ac8c28dfeef270b336dfde71b9c9c441b6364a189baa9710b231f950cb5663bdf2f58a9c07ad7a411783082a5e7711b08544fa7333b32210a
+	run_splice_case 1 c3b859699c69271ac8c28dfeef270b336dfde71b9c9c441b6364a189baa9710b231f950cb5663bdf2f58a9c07ad7a411783082a5e7711b08544fa7333b32210a "--async 4"
+fi
+
+run_resume_case 1 c3b859699c69271ac8c28dfeef270b336dfde71b9c9c441b6364a189baa9710b231f950cb5663bdf2f58a9c07ad7a411783082a5e7711b08544fa7333b32210a "--buffer 1000"
+run_resume_case 1 c3b859699c69271ac8c28dfeef270b336dfde71b9c9c441b6364a189baa9710b231f950cb5663bdf2f58a9c07ad7a411783082a5e7711b08544fa7333b32210a "--buffer 100000" 1
+run_resume_case 1 52feff2c7e2809dd1e80249bd031f35c7eabbed9899158fb1ce91d2f934948ee8ec900872aabd352e77d5bf55c827377604b3ff4868d912050f779e5c9814e36 "--counter" 1
+run_resume_case 1 5d1bf5d2694c482046e024a4f79c7f3f94c27b966534f6cbf73fbecd093526ea72519a6ae25ffffb8c1cc99a879c7589ee6aee7aa8618c47c759f0d3b62417c5 "" "" "--skip 1000"
+run_resume_case 1 5d1bf5d2694c482046e024a4f79c7f3f94c27b966534f6cbf73fbecd093526ea72519a6ae25ffffb8c1cc99a879c7589ee6aee7aa8618c47c759f0d3b62417c5 "--buffer 100000" 1 "--skip 1000"
+
+run_test_case 1 52feff2c7e2809dd1e80249bd031f35c7eabbed9899158fb1ce91d2f934948ee8ec900872aabd352e77d5bf55c827377604b3ff4868d912050f779e5c9814e36 "--counter"
+run_test_case 2 fc23987bf416efbfed73a1935d21be7561b018d364bbd9b3833de7fc72033a17600323c08d75a57e7a9b66198e1e70e7e99e75dcef69d93e6a49bd8421089d4d "--counter"
+run_test_case 1 7be411c58655508c4cf8f0ee2053bae84ff1a3b89d91e12b4b900a29ac2f2c0deae4ea2e87a3102115fc4432fc54ab4075184a46731a55775b509b5425bed177 "--counter --skip 3298534883328"
+
 run_test_case 1 c8bb566c40b78f82d3cd693d1f3f4dbe0d33b0c5e4c842621a3f3494b910e77193f20c5c947edfeaf68bb80b766398c4d42f7508eb3803af02d9e715140f9f1c "--hex"
 run_test_case 2 1441493d403335481de5dcce203d622a2ab158389809deaae96659a752973476cbd01f9753f60e1af580930ec67e8227b8747dcebbd310cbd0f7f8af3cadfff3 "--hex"
+run_test_case 1 f3de05816f75ccd2f696e67707850b37532512e3fac27c7e35f41bd88b9cad388d54c5e96b8fae8c2f9fdb25fcbdca64175abd63eadaca361153be9d385bbaf3 "--base64"
+run_test_case 2 eca6a97a7fae7d2b086e16ec7a63f554a96cb422952f74c1577531dc78734be7857c98917c42b4ac1620ea6c2aff007a368d1ea9ffe99333dbd1a88296e65df6 "--base64"
 
 while true; do
 	logfile=`mktemp -t run_tests-XXXXX.log`
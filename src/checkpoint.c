@@ -0,0 +1,140 @@
+/*
+ * XXH64-PRNG
+ * Blazing fast XXH64-based secure pseudo-random number generator
+ *
+ * Copyright (c) 2025 "dEajL3kA" <Cumpoing79@web.de>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * https://www.opensource.org/licenses/bsd-license.php
+ */
+
+#include "checkpoint.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#ifdef _WIN32
+#  define WIN32_LEAN_AND_MEAN 1
+#  include <windows.h>
+#  include <io.h>
+#else
+#  include <unistd.h>
+#  include <fcntl.h>
+#  include <sys/stat.h>
+#endif
+
+/* suffix of the temporary file, which is renamed to the final name once it has been written completely */
+#define TEMP_SUFFIX ".tmp"
+#define MAX_PATH_LEN 4096U
+
+/* ======================================================================== */
+/* File access                                                              */
+/* ======================================================================== */
+
+static bool write_temp_file(const char *const path, const uint8_t *const data, const size_t len)
+{
+    bool success = false;
+#ifdef _WIN32
+    FILE *const file = fopen(path, "wb");
+#else
+    const int fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, S_IRUSR | S_IWUSR);
+    FILE *const file = (fd >= 0) ? fdopen(fd, "wb") : NULL;
+    if ((!file) && (fd >= 0)) {
+        close(fd);
+    }
+#endif
+
+    if (!file) {
+        return false;
+    }
+
+    if ((fwrite(data, 1U, len, file) == len) && (fflush(file) == 0)) {
+#ifdef _WIN32
+        success = (_commit(_fileno(file)) == 0);
+#else
+        success = (fsync(fileno(file)) == 0);
+#endif
+    }
+
+    return (fclose(file) == 0) && success;
+}
+
+static bool replace_file(const char *const from, const char *const to)
+{
+#ifdef _WIN32
+    return MoveFileExA(from, to, MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != FALSE;
+#else
+    return rename(from, to) == 0;
+#endif
+}
+
+/* ======================================================================== */
+/* Checkpoint files                                                         */
+/* ======================================================================== */
+
+bool checkpoint_write(const char *const path, const xxh64prng_t *const state, const uint64_t offset, const uint64_t origin, const uint32_t flags)
+{
+    uint8_t data[XXH64PRNG_CHECKPOINT_BYTES];
+    char temp_path[MAX_PATH_LEN];
+    bool success = false;
+
+    const int len = snprintf(temp_path, MAX_PATH_LEN, "%s" TEMP_SUFFIX, path);
+    if ((len <= 0) || (((size_t)len) >= MAX_PATH_LEN)) {
+        return false;
+    }
+
+    xxh64prng_checkpoint_encode(data, state, offset, origin, flags);
+
+    if (write_temp_file(temp_path, data, XXH64PRNG_CHECKPOINT_BYTES)) {
+        success = replace_file(temp_path, path);
+    }
+
+    if (!success) {
+        remove(temp_path);
+    }
+
+    xxh64prng_zero(data, XXH64PRNG_CHECKPOINT_BYTES);
+    return success;
+}
+
+bool checkpoint_read(const char *const path, xxh64prng_t *const state, uint64_t *const offset, uint64_t *const origin, uint32_t *const flags)
+{
+    uint8_t data[XXH64PRNG_CHECKPOINT_BYTES + 1U];
+    bool success = false;
+    size_t len;
+
+    FILE *const file = fopen(path, "rb");
+    if (!file) {
+        return false;
+    }
+
+    /* read one byte more than expected, in order to detect trailing garbage */
+    len = fread(data, 1U, sizeof(data), file);
+    if ((len == XXH64PRNG_CHECKPOINT_BYTES) && (!ferror(file))) {
+        success = xxh64prng_checkpoint_decode(data, state, offset, origin, flags);
+    }
+
+    fclose(file);
+    xxh64prng_zero(data, sizeof(data));
+    return success;
+}
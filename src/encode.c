@@ -0,0 +1,304 @@
+/*
+ * XXH64-PRNG
+ * Blazing fast XXH64-based secure pseudo-random number generator
+ *
+ * Copyright (c) 2025 "dEajL3kA" <Cumpoing79@web.de>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * https://www.opensource.org/licenses/bsd-license.php
+ */
+
+#include "encode.h"
+
+#include "xxh64_simd.h"
+#include <string.h>
+
+static const uint8_t HEX_CHARS[16U] = {
+    '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'A', 'B', 'C', 'D', 'E', 'F'
+};
+
+static const uint8_t BASE64_CHARS[64U] = {
+    'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P',
+    'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X', 'Y', 'Z', 'a', 'b', 'c', 'd', 'e', 'f',
+    'g', 'h', 'i', 'j', 'k', 'l', 'm', 'n', 'o', 'p', 'q', 'r', 's', 't', 'u', 'v',
+    'w', 'x', 'y', 'z', '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', '+', '/'
+};
+
+typedef void (*encode_func_t)(const uint8_t *const input, const size_t length, uint8_t *const output);
+
+/* ======================================================================== */
+/* Scalar                                                                   */
+/* ======================================================================== */
+
+/* Each byte is encoded as two hex digits, the *low* nibble first */
+static void encode_hex_scalar(const uint8_t *const input, const size_t length, uint8_t *const output)
+{
+    size_t pos, offset = 0U;
+
+    for (pos = 0U; pos < length; ++pos) {
+        const uint8_t value = input[pos];
+        output[offset++] = HEX_CHARS[value & 0xF];
+        output[offset++] = HEX_CHARS[value >> 4];
+    }
+}
+
+static void encode_base64_scalar(const uint8_t *const input, const size_t length, uint8_t *const output)
+{
+    size_t pos, offset = 0U;
+
+    for (pos = 0U; pos + 3U <= length; pos += 3U) {
+        const uint32_t value = (((uint32_t)input[pos]) << 16) | (((uint32_t)input[pos + 1U]) << 8) | input[pos + 2U];
+        output[offset++] = BASE64_CHARS[(value >> 18) & 0x3F];
+        output[offset++] = BASE64_CHARS[(value >> 12) & 0x3F];
+        output[offset++] = BASE64_CHARS[(value >> 6) & 0x3F];
+        output[offset++] = BASE64_CHARS[value & 0x3F];
+    }
+
+    if (pos < length) {
+        const uint32_t value = (((uint32_t)input[pos]) << 16) | (((pos + 1U) < length) ? (((uint32_t)input[pos + 1U]) << 8) : 0U);
+        output[offset++] = BASE64_CHARS[(value >> 18) & 0x3F];
+        output[offset++] = BASE64_CHARS[(value >> 12) & 0x3F];
+        output[offset++] = ((pos + 1U) < length) ? BASE64_CHARS[(value >> 6) & 0x3F] : '=';
+        output[offset++] = '=';
+    }
+}
+
+/* ======================================================================== */
+/* x86: SSSE3 / AVX2                                                        */
+/* ======================================================================== */
+
+#if XXH_SIMD_X86
+
+/*
+ * Base64 encoding after W. Mula and D. Lemire, "Faster Base64 Encoding and Decoding using AVX2
+ * Instructions": Each 32-Bit lane holds the bytes [b1, b0, b2, b1] of one 3-byte group, which are
+ * split into four 6-Bit indices by multiplication, then mapped to ASCII via a small offset table.
+ */
+#define BASE64_SHUFFLE 10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1
+#define BASE64_OFFSETS 0, 0, 'A', '/' - 63, '+' - 62, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, 'a' - 26
+
+XXH_TARGET_SSSE3 static void encode_hex_ssse3(const uint8_t *const input, const size_t length, uint8_t *const output)
+{
+    const __m128i lut = _mm_loadu_si128((const __m128i*)HEX_CHARS);
+    const __m128i mask = _mm_set1_epi8(0x0F);
+    size_t pos;
+
+    for (pos = 0U; pos + 16U <= length; pos += 16U) {
+        const __m128i value = _mm_loadu_si128((const __m128i*)(input + pos));
+        const __m128i lo = _mm_shuffle_epi8(lut, _mm_and_si128(value, mask));
+        const __m128i hi = _mm_shuffle_epi8(lut, _mm_and_si128(_mm_srli_epi16(value, 4), mask));
+        _mm_storeu_si128((__m128i*)(output + 2U * pos), _mm_unpacklo_epi8(lo, hi));
+        _mm_storeu_si128((__m128i*)(output + 2U * pos + 16U), _mm_unpackhi_epi8(lo, hi));
+    }
+
+    encode_hex_scalar(input + pos, length - pos, output + 2U * pos);
+}
+
+XXH_TARGET_AVX2 static void encode_hex_avx2(const uint8_t *const input, const size_t length, uint8_t *const output)
+{
+    const __m256i lut = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)HEX_CHARS));
+    const __m256i mask = _mm256_set1_epi8(0x0F);
+    size_t pos;
+
+    for (pos = 0U; pos + 32U <= length; pos += 32U) {
+        const __m256i value = _mm256_loadu_si256((const __m256i*)(input + pos));
+        const __m256i lo = _mm256_shuffle_epi8(lut, _mm256_and_si256(value, mask));
+        const __m256i hi = _mm256_shuffle_epi8(lut, _mm256_and_si256(_mm256_srli_epi16(value, 4), mask));
+        const __m256i mix0 = _mm256_unpacklo_epi8(lo, hi), mix1 = _mm256_unpackhi_epi8(lo, hi);
+        _mm256_storeu_si256((__m256i*)(output + 2U * pos), _mm256_permute2x128_si256(mix0, mix1, 0x20));
+        _mm256_storeu_si256((__m256i*)(output + 2U * pos + 32U), _mm256_permute2x128_si256(mix0, mix1, 0x31));
+    }
+
+    encode_hex_scalar(input + pos, length - pos, output + 2U * pos);
+}
+
+XXH_TARGET_SSSE3 static __m128i base64_ssse3_lookup(const __m128i value)
+{
+    const __m128i shuffled = _mm_shuffle_epi8(value, _mm_set_epi8(BASE64_SHUFFLE));
+    const __m128i t0 = _mm_mulhi_epu16(_mm_and_si128(shuffled, _mm_set1_epi32(0x0FC0FC00)), _mm_set1_epi32(0x04000040));
+    const __m128i t1 = _mm_mullo_epi16(_mm_and_si128(shuffled, _mm_set1_epi32(0x003F03F0)), _mm_set1_epi32(0x01000010));
+    const __m128i indices = _mm_or_si128(t0, t1);
+    __m128i offset = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+    offset = _mm_or_si128(offset, _mm_and_si128(_mm_cmpgt_epi8(_mm_set1_epi8(26), indices), _mm_set1_epi8(13)));
+    return _mm_add_epi8(indices, _mm_shuffle_epi8(_mm_set_epi8(BASE64_OFFSETS), offset));
+}
+
+XXH_TARGET_SSSE3 static void encode_base64_ssse3(const uint8_t *const input, const size_t length, uint8_t *const output)
+{
+    size_t pos, offset = 0U;
+
+    for (pos = 0U; pos + 16U <= length; pos += 12U, offset += 16U) {
+        _mm_storeu_si128((__m128i*)(output + offset), base64_ssse3_lookup(_mm_loadu_si128((const __m128i*)(input + pos))));
+    }
+
+    encode_base64_scalar(input + pos, length - pos, output + offset);
+}
+
+XXH_TARGET_AVX2 static void encode_base64_avx2(const uint8_t *const input, const size_t length, uint8_t *const output)
+{
+    const __m256i shuffle = _mm256_set_epi8(BASE64_SHUFFLE, BASE64_SHUFFLE);
+    const __m256i offsets = _mm256_set_epi8(BASE64_OFFSETS, BASE64_OFFSETS);
+    const __m256i mask0 = _mm256_set1_epi32(0x0FC0FC00), mul0 = _mm256_set1_epi32(0x04000040);
+    const __m256i mask1 = _mm256_set1_epi32(0x003F03F0), mul1 = _mm256_set1_epi32(0x01000010);
+    size_t pos, offset = 0U;
+
+    for (pos = 0U; pos + 28U <= length; pos += 24U, offset += 32U) {
+        const __m256i value = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128((const __m128i*)(input + pos))), _mm_loadu_si128((const __m128i*)(input + pos + 12U)), 1);
+        const __m256i shuffled = _mm256_shuffle_epi8(value, shuffle);
+        const __m256i indices = _mm256_or_si256(_mm256_mulhi_epu16(_mm256_and_si256(shuffled, mask0), mul0), _mm256_mullo_epi16(_mm256_and_si256(shuffled, mask1), mul1));
+        __m256i index = _mm256_subs_epu8(indices, _mm256_set1_epi8(51));
+        index = _mm256_or_si256(index, _mm256_and_si256(_mm256_cmpgt_epi8(_mm256_set1_epi8(26), indices), _mm256_set1_epi8(13)));
+        _mm256_storeu_si256((__m256i*)(output + offset), _mm256_add_epi8(indices, _mm256_shuffle_epi8(offsets, index)));
+    }
+
+    encode_base64_scalar(input + pos, length - pos, output + offset);
+}
+
+#endif /*XXH_SIMD_X86*/
+
+/* ======================================================================== */
+/* ARM64: NEON                                                              */
+/* ======================================================================== */
+
+#if XXH_SIMD_NEON
+
+static void encode_hex_neon(const uint8_t *const input, const size_t length, uint8_t *const output)
+{
+    const uint8x16_t lut = vld1q_u8(HEX_CHARS);
+    const uint8x16_t mask = vdupq_n_u8(0x0F);
+    size_t pos;
+
+    for (pos = 0U; pos + 16U <= length; pos += 16U) {
+        const uint8x16_t value = vld1q_u8(input + pos);
+        uint8x16x2_t chars;
+        chars.val[0] = vqtbl1q_u8(lut, vandq_u8(value, mask));
+        chars.val[1] = vqtbl1q_u8(lut, vshrq_n_u8(value, 4));
+        vst2q_u8(output + 2U * pos, chars);
+    }
+
+    encode_hex_scalar(input + pos, length - pos, output + 2U * pos);
+}
+
+static void encode_base64_neon(const uint8_t *const input, const size_t length, uint8_t *const output)
+{
+    uint8x16x4_t lut;
+    const uint8x16_t mask = vdupq_n_u8(0x3F);
+    size_t pos, offset = 0U;
+
+    lut.val[0] = vld1q_u8(BASE64_CHARS);
+    lut.val[1] = vld1q_u8(BASE64_CHARS + 16U);
+    lut.val[2] = vld1q_u8(BASE64_CHARS + 32U);
+    lut.val[3] = vld1q_u8(BASE64_CHARS + 48U);
+
+    for (pos = 0U; pos + 48U <= length; pos += 48U, offset += 64U) {
+        const uint8x16x3_t value = vld3q_u8(input + pos);
+        uint8x16x4_t chars;
+        chars.val[0] = vqtbl4q_u8(lut, vshrq_n_u8(value.val[0], 2));
+        chars.val[1] = vqtbl4q_u8(lut, vandq_u8(vorrq_u8(vshlq_n_u8(value.val[0], 4), vshrq_n_u8(value.val[1], 4)), mask));
+        chars.val[2] = vqtbl4q_u8(lut, vandq_u8(vorrq_u8(vshlq_n_u8(value.val[1], 2), vshrq_n_u8(value.val[2], 6)), mask));
+        chars.val[3] = vqtbl4q_u8(lut, vandq_u8(value.val[2], mask));
+        vst4q_u8(output + offset, chars);
+    }
+
+    encode_base64_scalar(input + pos, length - pos, output + offset);
+}
+
+#endif /*XXH_SIMD_NEON*/
+
+/* ======================================================================== */
+/* Public functions                                                         */
+/* ======================================================================== */
+
+static encode_func_t encode_hex_func = NULL, encode_base64_func = NULL;
+
+/* Select the encoders that match the generator's implementation */
+static void encode_select(void)
+{
+    const xxh64prng_impl_t impl = xxh64prng_get_impl();
+
+    encode_hex_func = encode_hex_scalar;
+    encode_base64_func = encode_base64_scalar;
+
+#if XXH_SIMD_X86
+    if ((impl == XXH64PRNG_IMPL_AVX2) || (impl == XXH64PRNG_IMPL_AVX512)) {
+        encode_hex_func = encode_hex_avx2;
+        encode_base64_func = encode_base64_avx2;
+    }
+    else if (XXH_cpu_features() & XXH_CPU_SSSE3) {
+        encode_hex_func = encode_hex_ssse3;
+        encode_base64_func = encode_base64_ssse3;
+    }
+#elif XXH_SIMD_NEON
+    if (impl == XXH64PRNG_IMPL_NEON) {
+        encode_hex_func = encode_hex_neon;
+        encode_base64_func = encode_base64_neon;
+    }
+#else
+    (void)impl;
+#endif
+}
+
+size_t encode_input_limit(const encoding_t encoding, const size_t capacity)
+{
+    switch (encoding) {
+    case ENCODE_HEX:
+        return capacity / 2U;
+    case ENCODE_BASE64:
+        return (capacity / 4U) * 3U;
+    default:
+        return capacity;
+    }
+}
+
+uint64_t encode_output_length(const encoding_t encoding, const uint64_t length)
+{
+    switch (encoding) {
+    case ENCODE_HEX:
+        return (length <= (UINT64_MAX / 2U)) ? (2U * length) : UINT64_MAX;
+    case ENCODE_BASE64:
+        return (length <= ((UINT64_MAX / 4U) * 3U - 2U)) ? (4U * ((length + 2U) / 3U)) : UINT64_MAX;
+    default:
+        return length;
+    }
+}
+
+size_t encode(const encoding_t encoding, const uint8_t *const input, const size_t length, uint8_t *const output)
+{
+    if (!encode_hex_func) {
+        encode_select();
+    }
+
+    switch (encoding) {
+    case ENCODE_HEX:
+        encode_hex_func(input, length, output);
+        return 2U * length;
+    case ENCODE_BASE64:
+        encode_base64_func(input, length, output);
+        return 4U * ((length + 2U) / 3U);
+    default:
+        if (input != output) {
+            memmove(output, input, length);
+        }
+        return length;
+    }
+}
@@ -0,0 +1,55 @@
+/*
+ * XXH64-PRNG
+ * Blazing fast XXH64-based secure pseudo-random number generator
+ *
+ * Copyright (c) 2025 "dEajL3kA" <Cumpoing79@web.de>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * https://www.opensource.org/licenses/bsd-license.php
+ */
+
+#ifndef _XXH_RAND_ENCODE_H
+#define _XXH_RAND_ENCODE_H
+
+#include <xxh64_prng.h>
+
+/* output encodings */
+typedef enum {
+    ENCODE_RAW,
+    ENCODE_HEX,
+    ENCODE_BASE64
+} encoding_t;
+
+/* maximum input length whose encoding fits into "capacity" bytes; a multiple of the encoding's group size */
+size_t encode_input_limit(const encoding_t encoding, const size_t capacity);
+
+/* length of the encoding of "length" input bytes, or UINT64_MAX on overflow */
+uint64_t encode_output_length(const encoding_t encoding, const uint64_t length);
+
+/*
+ * Encode "length" bytes from "input" to "output", returning the output length. The input may overlap the output
+ * buffer, provided that it is located at the very end of the encoded output, i.e. at "output + encoded - length".
+ */
+size_t encode(const encoding_t encoding, const uint8_t *const input, const size_t length, uint8_t *const output);
+
+#endif /*_XXH_RAND_ENCODE_H*/
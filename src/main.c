@@ -30,23 +30,21 @@
 
 #include <xxh64_prng.h>
 
+#include "encode.h"
+#include "output.h"
+#include "checkpoint.h"
+#include "stats.h"
 #include <stdio.h>
 #include <string.h>
 #include <errno.h>
+#include <signal.h>
+#include <time.h>
 
 #ifdef _WIN32
 #  include <fcntl.h>
 #  include <io.h>
 #endif
 
-#if defined(_WIN32)
-#  define FWRITE_NOLOCK _fwrite_nolock
-#elif defined(__linux__) || defined(__CYGWIN__) || defined(__FreeBSD__) || defined(__HAIKU__)
-#  define FWRITE_NOLOCK fwrite_unlocked
-#else
-#  define FWRITE_NOLOCK fwrite
-#endif
-
 #ifdef _WIN32
 #  define STRICMP _stricmp
 #else
@@ -57,34 +55,30 @@
 /* Utility functions                                                        */
 /* ======================================================================== */
 
-#define HEX_BUFFLEN 256U
-
-static const char* const HEX_CHARS = "0123456789ABCDEF";
-
-static int fwrite_hexchars(const void *const input, const size_t length, FILE *const stream)
+static bool parse_impl(const char* const str, xxh64prng_impl_t* const impl)
 {
-    const uint8_t *const data = (const uint8_t*)input;
-    size_t pos, offset = 0U;
-    char hex_buffer[HEX_BUFFLEN];
-
-    for (pos = 0U; pos < length; ++pos) {
-        hex_buffer[offset++] = HEX_CHARS[data[pos] & 0xF];
-        hex_buffer[offset++] = HEX_CHARS[data[pos] >> 4L];
-        if (offset >= HEX_BUFFLEN) {
-            offset = 0U;
-            if (FWRITE_NOLOCK(hex_buffer, sizeof(char), HEX_BUFFLEN, stream) != HEX_BUFFLEN) {
-                return 0;
-            }
+    xxh64prng_impl_t candidate;
+    const char *name;
+    for (candidate = XXH64PRNG_IMPL_AUTO; (name = xxh64prng_impl_name(candidate)) != NULL; ++candidate) {
+        if (STRICMP(str, name) == 0) {
+            *impl = candidate;
+            return true;
         }
     }
+    return false;
+}
 
-    if (offset > 0U) {
-        if (FWRITE_NOLOCK(hex_buffer, sizeof(char), offset, stream) != offset) {
-            return 0;
+static bool parse_wipe(const char* const str, xxh64prng_wipe_t* const policy)
+{
+    xxh64prng_wipe_t candidate;
+    const char *name;
+    for (candidate = XXH64PRNG_WIPE_PARANOID; (name = xxh64prng_wipe_name(candidate)) != NULL; ++candidate) {
+        if (STRICMP(str, name) == 0) {
+            *policy = candidate;
+            return true;
         }
     }
-
-    return 1;
+    return false;
 }
 
 static bool parse_uint64(const char* const str, uint64_t* const value)
@@ -114,7 +108,7 @@ static void print_helpscreen(const bool full_help)
 
     const int len = snprintf(version_str, 32U, XXH64PRNG_VERSION_PATCH ? "%u.%u-%u" : "%u.%u", XXH64PRNG_VERSION_MAJOR, XXH64PRNG_VERSION_MINOR, XXH64PRNG_VERSION_PATCH);
     if ((len > 0) && (len < 32)) {
-        printf("XXH64-PRNG v%s [%s] [%s]\n", version_str, XXH64PRNG_ARCH, XXH64PRNG_DATE);
+        printf("XXH64-PRNG v%s [%s] [%s] [%s]\n", version_str, XXH64PRNG_ARCH, XXH64PRNG_DATE, xxh64prng_impl_name(xxh64prng_get_impl()));
     }
 
     if (full_help) {
@@ -123,11 +117,27 @@ static void print_helpscreen(const bool full_help)
         puts("  " EXE_FILENAME " [OPTIONS] [SEED] [OUTPUT_SIZE]\n");
         puts("Options:");
         puts("  --hex        Output as hexadecimal string. Default is \"raw\" bytes.");
+        puts("  --base64     Output as Base64 string. Default is \"raw\" bytes.");
         puts("  --no-buffer  Disable output buffering. Can be very slow!");
+        puts("  --buffer N   Size of the output buffers, in bytes. Default is 1 MiB.");
+        puts("  --output F   Write the output to file F, instead of the standard output.");
+        puts("  --async N    Write the output from a separate thread, through a ring of N buffers.");
+        puts("  --vmsplice   Hand the buffers to a pipe with vmsplice(). Unsafe if the reader uses splice()!");
+        puts("  --impl NAME  Select implementation: auto, scalar, avx2, avx512 or neon.");
+        puts("  --threads N  Number of threads. Default is 1, set to 0 to use all CPUs.");
+        puts("  --wipe MODE  Wiping of temporaries: paranoid (default), destroy or off.");
+        puts("  --counter    Use counter mode, which allows random access to the output.");
+        puts("  --skip N     Skip the first N bytes of the output, without generating them.");
+        puts("  --save-state F  Save a checkpoint to file F periodically, on exit and on SIGINT/SIGTERM.");
+        puts("  --resume F   Continue from the checkpoint in file F, instead of using a SEED.");
+        puts("  --checksum   Print the XXH64 checksum of the output to the standard error on exit.");
+        puts("  --stats      Print statistics to the standard error on exit.");
+        puts("  --stats-interval N  Also print statistics every N seconds (implies \"--stats\").");
         puts("  --help       Print help screen and exit.");
         puts("  --version    Print version information and exit.\n");
         puts("If SEED is *not* specified (or set to \"-\"), uses a random seed from the OS' entropy source.");
         puts("If OUTPUT_SIZE is *not* specified, generates an indefinite amount of random bytes.");
+        puts("When resuming, OUTPUT_SIZE includes the bytes that were output before the checkpoint.");
     }
 }
 
@@ -135,34 +145,169 @@ static void print_helpscreen(const bool full_help)
 /* Generation loop                                                          */
 /* ======================================================================== */
 
-static void generate_loop(xxh64prng_t *const state, uint64_t remaining, const bool hex_output)
+#define MAX_THREADS 1024U
+
+#define GENERATE_BUFSIZE (1U << 20)
+#define GENERATE_BUFSIZE_MT (4U << 20)
+#define GENERATE_BUFSIZE_FILE (64U << 20)
+#define MAX_BUFSIZE (UINT64_C(1) << 30)
+#define MAX_ASYNC_DEPTH 64U
+
+#define CHECKPOINT_INTERVAL 10.0 /* seconds */
+
+typedef struct generator {
+    bool counter_mode;
+    xxh64prng_stream_t stream;
+    xxh64prng_ctr_t ctr;
+    xxh64prng_mt_t *mt;
+    uint64_t position;      /* offset of the next byte to be output */
+    uint64_t origin;        /* offset of the first byte that was output, i.e. the number of skipped bytes */
+    xxh64prng_t base;       /* counter mode: the key state; chain mode: the state at offset "base_position" */
+    uint64_t base_position; /* chain mode: the start of the block containing "position" */
+    xxh64prng_t pending;       /* chain mode: the state at "pending_position", which is still being output */
+    uint64_t pending_position; /* the last block boundary in the current chunk, or zero */
+    const char *checkpoint;
+    time_t checkpoint_time;
+    stats_t *stats;
+    xxh64prng_hash_t *checksum; /* XXH64 of the output, NULL = disabled */
+} generator_t;
+
+static volatile sig_atomic_t stop_signal = 0;
+
+static void signal_handler(const int sig)
 {
-    uint64_t buffer[XXH64PRNG_OUTPUT_WORDS];
+    stop_signal = sig;
+}
 
-    while (remaining) {
-        const size_t chunk_size = (remaining >= XXH64PRNG_OUTPUT_BYTES) ? XXH64PRNG_OUTPUT_BYTES : ((size_t)remaining);
+static void generator_fill(generator_t *const gen, void *const buffer, const size_t len)
+{
+    if (gen->counter_mode) {
+        if (gen->mt) {
+            xxh64prng_mt_ctr_fill(gen->mt, &gen->ctr, buffer, len);
+        }
+        else {
+            xxh64prng_ctr_fill(&gen->ctr, buffer, len);
+        }
+    }
+    else {
+        if (gen->mt) {
+            xxh64prng_mt_fill(gen->mt, &gen->stream, buffer, len);
+        }
+        else {
+            xxh64prng_fill(&gen->stream, buffer, len);
+        }
+    }
+}
 
-        xxh64prng_next(state, buffer);
+/* Fill the final chunk of the output; the part of the last block that would never be output is not computed */
+static void generator_fill_final(generator_t *const gen, void *const buffer, const size_t len)
+{
+    if (gen->mt) {
+        generator_fill(gen, buffer, len);
+    }
+    else if (gen->counter_mode) {
+        xxh64prng_ctr_fill_final(&gen->ctr, buffer, len);
+    }
+    else {
+        xxh64prng_fill_final(&gen->stream, buffer, len);
+    }
+}
 
-        if (!hex_output) {
-            if (FWRITE_NOLOCK(buffer, 1U, chunk_size, stdout) != chunk_size) {
-                break;
-            }
+/*
+ * Fill the next chunk of the output. With checkpoints in chain mode, the chunk is filled in two parts, split at
+ * its last block boundary, where the state of the stream is the state of the block starting there. This state is
+ * kept, so that a checkpoint never needs to iterate the state, regardless of the chunk size.
+ */
+static void generator_generate(generator_t *const gen, uint8_t *const buffer, const size_t len, const bool final)
+{
+    size_t head = 0U;
+
+    if (gen->checkpoint && (!gen->counter_mode)) {
+        const uint64_t end = gen->position + len;
+        const uint64_t boundary = end - (end % XXH64PRNG_OUTPUT_BYTES);
+        if (boundary > gen->position) {
+            head = (size_t)(boundary - gen->position);
+            generator_fill(gen, buffer, head);
+            gen->pending = gen->stream.prng;
+            gen->pending_position = boundary;
+        }
+    }
+
+    if (head < len) {
+        if (final) {
+            generator_fill_final(gen, buffer + head, len - head);
         }
         else {
-            if (!fwrite_hexchars(buffer, chunk_size, stdout)) {
-                break;
-            }
+            generator_fill(gen, buffer + head, len - head);
         }
+    }
+}
+
+/* Write a checkpoint for the current position; in chain mode, the saved state is the one of the block containing it */
+static bool generator_save(generator_t *const gen)
+{
+    const bool success = checkpoint_write(gen->checkpoint, &gen->base, gen->position, gen->origin, gen->counter_mode ? XXH64PRNG_CHECKPOINT_COUNTER : 0U);
+    gen->checkpoint_time = time(NULL);
+    return success;
+}
 
-        xxh64prng_zero(buffer, sizeof(buffer));
+/* Account for "len" bytes that have been output, and write a periodic checkpoint, if it is due */
+static void generator_advance(generator_t *const gen, output_t *const output, const size_t len)
+{
+    gen->position += len;
+
+    if (gen->checkpoint) {
+        if ((!gen->counter_mode) && (gen->pending_position > gen->base_position)) {
+            gen->base = gen->pending; /* the chunk has been output up to (at least) the pending block boundary */
+            gen->base_position = gen->pending_position;
+        }
+        if ((!stop_signal) && (difftime(time(NULL), gen->checkpoint_time) >= CHECKPOINT_INTERVAL) && output_flush(output) && (!generator_save(gen))) {
+            fprintf(stderr, "Warning: Failed to write the checkpoint file \"%s\"!\n", gen->checkpoint);
+        }
+    }
+}
+
+static bool generate_loop(generator_t *const gen, output_t *const output, uint64_t remaining, const encoding_t encoding, const bool no_buffer)
+{
+    while (remaining) {
+        const double start_time = stats_clock(gen->stats);
+        uint8_t *const buffer = output_buffer(output);
+        const size_t capacity = output_capacity(output);
+        const size_t limit = encode_input_limit(encoding, (no_buffer && (capacity > XXH64PRNG_OUTPUT_BYTES)) ? XXH64PRNG_OUTPUT_BYTES : capacity);
+        const size_t chunk_size = (remaining >= limit) ? limit : ((size_t)remaining);
+        uint8_t *const input = buffer + ((size_t)encode_output_length(encoding, chunk_size) - chunk_size); /* encoded in-place */
+        const double fill_time = stats_clock(gen->stats);
+        double encode_time, commit_time;
+        size_t encoded;
+
+        generator_generate(gen, input, chunk_size, chunk_size == remaining);
+
+        encode_time = stats_clock(gen->stats);
+        encoded = encode(encoding, input, chunk_size, buffer);
+        if (gen->checksum) {
+            xxh64prng_hash_update(gen->checksum, buffer, encoded); /* while the output is still in the cache */
+        }
+        commit_time = stats_clock(gen->stats);
+
+        if (!output_commit(output, encoded)) {
+            return false;
+        }
+
+        stats_account(gen->stats, chunk_size, encode_time - fill_time, commit_time - encode_time, (fill_time - start_time) + (stats_clock(gen->stats) - commit_time));
+        stats_report(gen->stats, output, false);
 
         if (remaining != UINT64_MAX) {
             remaining -= chunk_size;
         }
+
+        generator_advance(gen, output, chunk_size);
+
+        if (stop_signal) {
+            break; /* the final checkpoint is written by the caller */
+        }
     }
 
-    xxh64prng_zero(buffer, sizeof(buffer));
+    return true;
 }
 
 /* ======================================================================== */
@@ -172,9 +317,16 @@ static void generate_loop(xxh64prng_t *const state, uint64_t remaining, const bo
 int main(int argc, char *argv[])
 {
     int index = 1, exit_code = EXIT_FAILURE;
-    bool hex_output = false, no_buffer = false, show_help = false, full_help = false, is_seeded = false;
+    bool no_buffer = false, show_help = false, full_help = false, is_seeded = false, counter_mode = false, completed = false, show_stats = false, show_checksum = false, use_vmsplice = false;
     xxh64prng_t state;
-    uint64_t output_size = UINT64_MAX;
+    xxh64prng_hash_t checksum;
+    generator_t gen;
+    output_t *output = NULL;
+    stats_t *stats = NULL;
+    double flush_time;
+    const char *output_file = NULL, *save_file = NULL, *resume_file = NULL;
+    encoding_t encoding = ENCODE_RAW;
+    uint64_t output_size = UINT64_MAX, threads = 1U, skip = 0U, buffer_size = 0U, remaining = UINT64_MAX, async_depth = 0U, stats_interval = 0U;
 
     while (index < argc) {
         if (((argv[index][0] == '/') || (argv[index][0] == '-')) && (argv[index][1] == '?')) {
@@ -188,11 +340,96 @@ int main(int argc, char *argv[])
                 break; /*no more options*/
             }
             else if (STRICMP(arg, "hex") == 0) {
-                hex_output = true;
+                encoding = ENCODE_HEX;
+            }
+            else if (STRICMP(arg, "base64") == 0) {
+                encoding = ENCODE_BASE64;
             }
             else if (STRICMP(arg, "no-buffer") == 0) {
                 no_buffer = true;
             }
+            else if (STRICMP(arg, "buffer") == 0) {
+                if ((index >= argc) || (!parse_uint64(argv[index], &buffer_size)) || (!buffer_size) || (buffer_size > MAX_BUFSIZE)) {
+                    fprintf(stderr, "Error: Option \"--%s\" requires a valid buffer size!\n", arg);
+                    return EXIT_FAILURE;
+                }
+                ++index;
+            }
+            else if (STRICMP(arg, "output") == 0) {
+                if ((index >= argc) || (!argv[index][0])) {
+                    fprintf(stderr, "Error: Option \"--%s\" requires a file name!\n", arg);
+                    return EXIT_FAILURE;
+                }
+                output_file = argv[index++];
+            }
+            else if (STRICMP(arg, "async") == 0) {
+                if ((index >= argc) || (!parse_uint64(argv[index], &async_depth)) || (async_depth < 2U) || (async_depth > MAX_ASYNC_DEPTH)) {
+                    fprintf(stderr, "Error: Option \"--%s\" requires a number of buffers between 2 and %u!\n", arg, MAX_ASYNC_DEPTH);
+                    return EXIT_FAILURE;
+                }
+                ++index;
+            }
+            else if (STRICMP(arg, "impl") == 0) {
+                xxh64prng_impl_t impl = XXH64PRNG_IMPL_AUTO;
+                if ((index >= argc) || (!parse_impl(argv[index], &impl))) {
+                    fprintf(stderr, "Error: Option \"--%s\" requires a valid implementation name!\n", arg);
+                    return EXIT_FAILURE;
+                }
+                if (!xxh64prng_set_impl(impl)) {
+                    fprintf(stderr, "Error: Implementation \"%s\" is not supported on this CPU!\n", argv[index]);
+                    return EXIT_FAILURE;
+                }
+                ++index;
+            }
+            else if (STRICMP(arg, "wipe") == 0) {
+                xxh64prng_wipe_t policy = XXH64PRNG_WIPE_PARANOID;
+                if ((index >= argc) || (!parse_wipe(argv[index], &policy)) || (!xxh64prng_set_wipe(policy))) {
+                    fprintf(stderr, "Error: Option \"--%s\" requires a valid wiping mode!\n", arg);
+                    return EXIT_FAILURE;
+                }
+                ++index;
+            }
+            else if (STRICMP(arg, "threads") == 0) {
+                if ((index >= argc) || (!parse_uint64(argv[index], &threads)) || (threads > MAX_THREADS)) {
+                    fprintf(stderr, "Error: Option \"--%s\" requires a valid number of threads!\n", arg);
+                    return EXIT_FAILURE;
+                }
+                ++index;
+            }
+            else if (STRICMP(arg, "vmsplice") == 0) {
+                use_vmsplice = true;
+            }
+            else if (STRICMP(arg, "counter") == 0) {
+                counter_mode = true;
+            }
+            else if (STRICMP(arg, "skip") == 0) {
+                if ((index >= argc) || (!parse_uint64(argv[index], &skip))) {
+                    fprintf(stderr, "Error: Option \"--%s\" requires a valid number of bytes!\n", arg);
+                    return EXIT_FAILURE;
+                }
+                ++index;
+            }
+            else if ((STRICMP(arg, "save-state") == 0) || (STRICMP(arg, "resume") == 0)) {
+                if ((index >= argc) || (!argv[index][0])) {
+                    fprintf(stderr, "Error: Option \"--%s\" requires a file name!\n", arg);
+                    return EXIT_FAILURE;
+                }
+                *((STRICMP(arg, "resume") == 0) ? &resume_file : &save_file) = argv[index++];
+            }
+            else if (STRICMP(arg, "checksum") == 0) {
+                show_checksum = true;
+            }
+            else if (STRICMP(arg, "stats") == 0) {
+                show_stats = true;
+            }
+            else if (STRICMP(arg, "stats-interval") == 0) {
+                if ((index >= argc) || (!parse_uint64(argv[index], &stats_interval)) || (!stats_interval)) {
+                    fprintf(stderr, "Error: Option \"--%s\" requires a valid number of seconds!\n", arg);
+                    return EXIT_FAILURE;
+                }
+                show_stats = true;
+                ++index;
+            }
             else if (STRICMP(arg, "help") == 0) {
                 show_help = true;
                 full_help = true;
@@ -215,18 +452,14 @@ int main(int argc, char *argv[])
         return EXIT_SUCCESS;
     }
 
+    memset(&gen, 0, sizeof(generator_t));
+
 #ifdef _WIN32
     if (_setmode(_fileno(stdout), O_BINARY) == (-1)) {
         abort();
     }
 #endif
 
-    if (no_buffer) {
-        if (setvbuf(stdout, NULL, _IONBF, 0U) != 0) {
-            abort();
-        }
-    }
-
     if (index < argc) {
         if ((*argv[index]) && (STRICMP(argv[index], "-") != 0)) {
             uint64_t seed;
@@ -254,18 +487,156 @@ int main(int argc, char *argv[])
         fputs("Warning: Ignoring the excess argument(s)!\n", stderr);
     }
 
-    if (!(is_seeded || xxh64prng_seed(&state))) {
-        fputs("Error: Failed to acquire seed data from the system's entropy source!\n", stderr);
+    if (resume_file) {
+        uint32_t flags = 0U;
+        if (is_seeded || skip) {
+            fputs("Error: Option \"--resume\" can not be combined with a SEED or with \"--skip\"!\n", stderr);
+            goto clean_up;
+        }
+        if (!checkpoint_read(resume_file, &state, &gen.position, &gen.origin, &flags)) {
+            fprintf(stderr, "Error: Failed to read the checkpoint file \"%s\", or the file is corrupted!\n", resume_file);
+            goto clean_up;
+        }
+        if (counter_mode && (!(flags & XXH64PRNG_CHECKPOINT_COUNTER))) {
+            fputs("Error: The checkpoint was not created in counter mode!\n", stderr);
+            goto clean_up;
+        }
+        counter_mode = (flags & XXH64PRNG_CHECKPOINT_COUNTER) != 0U;
+        gen.base_position = gen.position - (gen.position % XXH64PRNG_OUTPUT_BYTES); /* the checkpoint state belongs to this offset */
+        if (output_size != UINT64_MAX) {
+            remaining = (output_size > (gen.position - gen.origin)) ? (output_size - (gen.position - gen.origin)) : 0U;
+        }
+    }
+    else {
+        if (!(is_seeded || xxh64prng_seed(&state))) {
+            fputs("Error: Failed to acquire seed data from the system's entropy source!\n", stderr);
+            goto clean_up;
+        }
+        gen.position = gen.origin = skip;
+        remaining = output_size;
+    }
+
+    gen.counter_mode = counter_mode;
+    gen.base = state;
+    if (counter_mode) {
+        xxh64prng_ctr_init(&gen.ctr, &state);
+        xxh64prng_ctr_seek(&gen.ctr, gen.position);
+    }
+    else {
+        xxh64prng_discard(&gen.base, (gen.position - gen.base_position) / XXH64PRNG_OUTPUT_BYTES);
+        gen.base_position = gen.position - (gen.position % XXH64PRNG_OUTPUT_BYTES);
+        xxh64prng_stream_resume(&gen.stream, &gen.base, gen.position);
+    }
+
+    if (save_file) {
+        gen.checkpoint = save_file;
+        gen.checkpoint_time = time(NULL);
+    }
+
+    if (save_file || show_stats) {
+        signal(SIGINT, signal_handler);
+        signal(SIGTERM, signal_handler);
+#ifdef SIGPIPE
+        signal(SIGPIPE, SIG_IGN); /* a closed pipe must not kill the process before the final checkpoint or report */
+#endif
+    }
+
+    /* before the worker threads are created, so that the performance counters are inherited by them */
+    if (show_stats && (!(gen.stats = stats = stats_create((double)stats_interval)))) {
+        fputs("Error: Failed to allocate the statistics!\n", stderr);
+        goto clean_up;
+    }
+
+    if (show_checksum) {
+        xxh64prng_hash_init(&checksum, 0U);
+        gen.checksum = &checksum;
+    }
+
+    if ((threads != 1U) && (!(gen.mt = xxh64prng_mt_create((size_t)threads)))) {
+        fputs("Error: Failed to create the worker threads!\n", stderr);
+        goto clean_up;
+    }
+
+    if (!buffer_size) {
+        buffer_size = output_file ? GENERATE_BUFSIZE_FILE : (gen.mt ? GENERATE_BUFSIZE_MT : GENERATE_BUFSIZE);
+    }
+
+    if (output_file) {
+        /* when resuming, the file is continued at the checkpoint, it holds the output from the origin onwards */
+        const uint64_t file_offset = encode_output_length(encoding, gen.position - gen.origin);
+        const uint64_t file_size = (remaining != UINT64_MAX) ? encode_output_length(encoding, remaining) : UINT64_MAX;
+        if (!(output = output_create_file(output_file, file_offset, file_size, (size_t)buffer_size))) {
+            if (file_offset) {
+                fprintf(stderr, "Error: Failed to open the output file \"%s\", or it is shorter than the checkpoint offset!\n", output_file);
+            }
+            else {
+                fprintf(stderr, "Error: Failed to create the output file \"%s\"!\n", output_file);
+            }
+            goto clean_up;
+        }
+    }
+    else if (!(output = output_create(stdout, (size_t)buffer_size))) {
+        fputs("Error: Failed to allocate the output buffer!\n", stderr);
         goto clean_up;
     }
 
-    generate_loop(&state, output_size, hex_output);
+    if (use_vmsplice && (!output_use_vmsplice(output))) {
+        fputs("Warning: vmsplice() is not available for this output, using write() instead.\n", stderr);
+    }
+
+    if (async_depth && (!output_start_async(output, (size_t)async_depth))) {
+        fputs("Error: Failed to start the asynchronous writer!\n", stderr);
+        goto clean_up;
+    }
+
+    completed = generate_loop(&gen, output, remaining, encoding, no_buffer);
+    flush_time = stats_clock(stats);
+    completed = output_flush(output) && completed;
+    stats_account(stats, 0U, 0.0, 0.0, stats_clock(stats) - flush_time);
+
+    /* after an asynchronous write has failed, it is unknown how much of the queued output has been written */
+    if (gen.checkpoint && (completed || (!async_depth)) && (!generator_save(&gen))) {
+        fprintf(stderr, "Error: Failed to write the checkpoint file \"%s\"!\n", gen.checkpoint);
+        goto clean_up;
+    }
+
+    if (!completed) {
+        if (output_file) {
+            fprintf(stderr, "Error: Failed to write the output file \"%s\"!\n", output_file);
+            goto clean_up;
+        }
+        if (gen.checkpoint) {
+            goto clean_up;
+        }
+    }
+
+    if (stop_signal) {
+        /* the file has been preallocated to its full size, so cut it off where the output stopped */
+        if (output_file && (!output_truncate(output, encode_output_length(encoding, gen.position - gen.origin)))) {
+            fprintf(stderr, "Error: Failed to truncate the output file \"%s\"!\n", output_file);
+            goto clean_up;
+        }
+        if (gen.checkpoint) {
+            fprintf(stderr, "Interrupted, checkpoint saved at offset %llu.\n", (unsigned long long)gen.position);
+        }
+        exit_code = 128 + ((int)stop_signal);
+        goto clean_up;
+    }
+
+    if (gen.checksum) {
+        fprintf(stderr, "XXH64 checksum: %016llX\n", (unsigned long long)xxh64prng_hash_digest(gen.checksum));
+    }
 
     exit_code = EXIT_SUCCESS;
 
 clean_up:
 
+    stats_report(stats, output, true);
+    xxh64prng_mt_destroy(gen.mt); /* the worker threads must be gone before the counters are released */
+    stats_destroy(stats);
+    output_destroy(output);
     xxh64prng_zero(&state, sizeof(xxh64prng_t));
+    xxh64prng_zero(&gen, sizeof(generator_t));
 
     return exit_code;
 }
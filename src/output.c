@@ -0,0 +1,722 @@
+/*
+ * XXH64-PRNG
+ * Blazing fast XXH64-based secure pseudo-random number generator
+ *
+ * Copyright (c) 2025 "dEajL3kA" <Cumpoing79@web.de>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * https://www.opensource.org/licenses/bsd-license.php
+ */
+
+#if defined(__linux__) && (!defined(_GNU_SOURCE))
+#  define _GNU_SOURCE 1 /* required for vmsplice(), fallocate() and F_SETPIPE_SZ */
+#endif
+
+#ifndef _WIN32
+#  define _FILE_OFFSET_BITS 64
+#endif
+
+#include "output.h"
+#include "os_support.h"
+
+#include <string.h>
+#include <errno.h>
+
+#ifdef _WIN32
+#  include <malloc.h>
+#  include <io.h>
+#else
+#  include <unistd.h>
+#  include <fcntl.h>
+#  include <sys/stat.h>
+#  include <sys/mman.h>
+#endif
+
+#ifdef __linux__
+#  include <sys/uio.h>
+#endif
+
+#if defined(_WIN32)
+#  define FWRITE_NOLOCK _fwrite_nolock
+#elif defined(__linux__) || defined(__CYGWIN__) || defined(__FreeBSD__) || defined(__HAIKU__)
+#  define FWRITE_NOLOCK fwrite_unlocked
+#else
+#  define FWRITE_NOLOCK fwrite
+#endif
+
+#if defined(__linux__) && defined(F_SETPIPE_SZ) && defined(SPLICE_F_NONBLOCK)
+#  define HAVE_VMSPLICE 1
+#else
+#  define HAVE_VMSPLICE 0
+#endif
+
+#if !defined(_WIN32)
+#  define HAVE_MMAP 1
+#else
+#  define HAVE_MMAP 0
+#endif
+
+/* buffers are page-aligned, so that they can be handed to the kernel */
+#define OUTPUT_ALIGNMENT 4096U
+
+/* number of buffers, used alternately */
+#define OUTPUT_BUFFERS 2U
+
+/* maximum number of buffers in the ring of the asynchronous writer */
+#define OUTPUT_MAX_BUFFERS 64U
+
+typedef enum {
+    OUTPUT_STDIO,    /* FILE stream, unbuffered */
+    OUTPUT_WRITE,    /* write() on the file descriptor */
+    OUTPUT_VMSPLICE, /* vmsplice() into a pipe */
+    OUTPUT_MMAP      /* file mapped into memory, window by window */
+} output_mode_t;
+
+struct output {
+    output_mode_t mode;
+    FILE *stream;
+    bool owns_stream;
+    int fd;
+    size_t capacity;
+    size_t current;
+    size_t buffer_count;
+    uint8_t *buffers[OUTPUT_MAX_BUFFERS];
+    /* asynchronous writer; the counters and flags are protected by monitor */
+    xxh64prng_os_thread_t *writer;
+    xxh64prng_os_monitor_t *monitor;
+    size_t lengths[OUTPUT_MAX_BUFFERS];
+    uint64_t submitted, written, released;
+    bool failed, shutdown;
+    /* write statistics; with the asynchronous writer, only the "reported" copies (protected by monitor) may be read */
+    uint64_t write_calls, short_writes;
+    uint64_t reported_calls, reported_short;
+#if HAVE_MMAP
+    uint64_t file_size, file_offset;
+    uint8_t *window;
+    size_t window_len, window_pos;
+#endif
+};
+
+/* ======================================================================== */
+/* Memory allocation                                                        */
+/* ======================================================================== */
+
+static uint8_t *alloc_aligned(const size_t size)
+{
+#ifdef _WIN32
+    return (uint8_t*)_aligned_malloc(size, OUTPUT_ALIGNMENT);
+#else
+    void *ptr = NULL;
+    return (posix_memalign(&ptr, OUTPUT_ALIGNMENT, size) == 0) ? ((uint8_t*)ptr) : NULL;
+#endif
+}
+
+static void free_aligned(uint8_t *const ptr)
+{
+#ifdef _WIN32
+    _aligned_free(ptr);
+#else
+    free(ptr);
+#endif
+}
+
+/* ======================================================================== */
+/* Output functions                                                         */
+/* ======================================================================== */
+
+#ifndef _WIN32
+static bool write_fully(output_t *const output, const uint8_t *data, size_t len)
+{
+    while (len > 0U) {
+        const ssize_t result = write(output->fd, data, len);
+        ++output->write_calls;
+        if (result < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        if (((size_t)result) < len) {
+            ++output->short_writes;
+        }
+        data += result;
+        len -= (size_t)result;
+    }
+    return true;
+}
+#endif
+
+#if HAVE_VMSPLICE
+/*
+ * The pipe holds references to the pages, rather than a copy of the data, so a buffer must not be
+ * overwritten until the reader has consumed it. With a pipe capacity not exceeding the buffer size,
+ * the data has left *this* pipe as soon as the *next* (full) buffer has been spliced completely.
+ * Therefore, partially filled buffers are written with write(), and we only switch buffers after a
+ * splice. This is NOT sufficient, if the reader moves the pages on with splice() or tee(), because
+ * then the references outlive the pipe; that is why vmsplice() must be enabled explicitly.
+ */
+static bool setup_vmsplice(output_t *const output)
+{
+    struct stat info;
+    int pipe_size;
+
+    if ((fstat(output->fd, &info) != 0) || (!S_ISFIFO(info.st_mode))) {
+        return false;
+    }
+
+    if (output->capacity <= (size_t)INT32_MAX) {
+        fcntl(output->fd, F_SETPIPE_SZ, (int)output->capacity); /* may fail, e.g. due to "pipe-max-size" */
+    }
+
+    return ((pipe_size = fcntl(output->fd, F_GETPIPE_SZ)) > 0) && (((size_t)pipe_size) <= output->capacity);
+}
+
+static bool vmsplice_fully(output_t *const output, const uint8_t *data, size_t len)
+{
+    struct iovec iov;
+
+    while (len > 0U) {
+        ssize_t result;
+        iov.iov_base = (void*)data;
+        iov.iov_len = len;
+        ++output->write_calls;
+        if ((result = vmsplice(output->fd, &iov, 1U, 0U)) < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            if ((errno == EINVAL) || (errno == ENOSYS) || (errno == EPERM)) {
+                output->mode = OUTPUT_WRITE; /* not supported here, fall back to write() */
+                return write_fully(output, data, len);
+            }
+            return false;
+        }
+        if (((size_t)result) < len) {
+            ++output->short_writes;
+        }
+        data += result;
+        len -= (size_t)result;
+    }
+
+    return true;
+}
+#endif
+
+/* Write "len" bytes from a buffer; "spliced" is set, if the pages of the buffer have been handed to the pipe */
+static bool write_buffer(output_t *const output, const uint8_t *const data, const size_t len, bool *const spliced)
+{
+    switch (output->mode) {
+    case OUTPUT_STDIO:
+        ++output->write_calls;
+        if (FWRITE_NOLOCK(data, 1U, len, output->stream) != len) {
+            ++output->short_writes;
+            return false;
+        }
+        return true;
+#ifndef _WIN32
+    case OUTPUT_WRITE:
+        return write_fully(output, data, len);
+#endif
+#if HAVE_VMSPLICE
+    case OUTPUT_VMSPLICE:
+        if (len < output->capacity) {
+            return write_fully(output, data, len);
+        }
+        *spliced = true;
+        return vmsplice_fully(output, data, len);
+#endif
+    default:
+        return false;
+    }
+}
+
+/* ======================================================================== */
+/* Asynchronous writer                                                      */
+/* ======================================================================== */
+
+/*
+ * The buffers are used as a ring: the producer fills buffer "submitted % buffer_count", the writer thread writes
+ * buffer "written % buffer_count", and a buffer can be reused once it has been released. Usually, a buffer is
+ * released as soon as it has been written. But, after a splice, the buffer stays referenced by the pipe, so it
+ * is only released after the *next* full buffer has been spliced (see above). Only the very last buffer of the
+ * output may be partially filled, and the producer does not wait for a free buffer after that one.
+ */
+static void writer_main(void *const arg)
+{
+    output_t *const output = (output_t*)arg;
+    bool held = false;
+
+    xxh64prng_os_monitor_enter(output->monitor);
+
+    for (;;) {
+        const uint8_t *data;
+        size_t len;
+        bool success, spliced = false;
+
+        while ((output->written >= output->submitted) && (!output->shutdown)) {
+            xxh64prng_os_monitor_wait(output->monitor);
+        }
+        if (output->written >= output->submitted) {
+            break; /*shutdown*/
+        }
+
+        data = output->buffers[output->written % output->buffer_count];
+        len = output->lengths[output->written % output->buffer_count];
+        success = !output->failed;
+        xxh64prng_os_monitor_leave(output->monitor);
+
+        if (success) {
+            success = write_buffer(output, data, len, &spliced); /* skipped after a failure, the output is broken anyway */
+        }
+
+        xxh64prng_os_monitor_enter(output->monitor);
+        ++output->written;
+        output->reported_calls = output->write_calls;
+        output->reported_short = output->short_writes;
+        if (!success) {
+            output->failed = true;
+            held = false;
+        }
+        if (spliced) {
+            output->released = output->written - 1U;
+            held = true;
+        }
+        else if (!held) {
+            output->released = output->written;
+        }
+        xxh64prng_os_monitor_notify(output->monitor);
+    }
+
+    xxh64prng_os_monitor_leave(output->monitor);
+}
+
+/* Wait until the next buffer in the ring has been released; the wait ends early, if a write has failed */
+static void acquire_async(output_t *const output)
+{
+    xxh64prng_os_monitor_enter(output->monitor);
+    while ((output->submitted - output->released >= output->buffer_count) && (!output->failed)) {
+        xxh64prng_os_monitor_wait(output->monitor);
+    }
+    xxh64prng_os_monitor_leave(output->monitor);
+}
+
+/* Queue the current buffer for writing; fails, if a previous write has failed */
+static bool commit_async(output_t *const output, const size_t len)
+{
+    bool success;
+
+    xxh64prng_os_monitor_enter(output->monitor);
+    output->lengths[output->current] = len;
+    ++output->submitted;
+    success = !output->failed;
+    xxh64prng_os_monitor_notify(output->monitor);
+    xxh64prng_os_monitor_leave(output->monitor);
+
+    output->current = (size_t)(output->submitted % output->buffer_count);
+    return success;
+}
+
+#if HAVE_MMAP
+static bool preallocate(const int fd, const uint64_t size)
+{
+    if ((uint64_t)((off_t)size) != size) {
+        return false;
+    }
+#ifdef __linux__
+    if (fallocate(fd, 0, 0, (off_t)size) == 0) {
+        return true;
+    }
+    if ((errno != EOPNOTSUPP) && (errno != ENOSYS)) {
+        return false;
+    }
+#endif
+    return (ftruncate(fd, (off_t)size) == 0);
+}
+
+static bool map_window(output_t *const output)
+{
+    const uint64_t remaining = output->file_size - output->file_offset;
+    void *addr;
+
+    output->window_len = (remaining < output->capacity) ? ((size_t)remaining) : output->capacity;
+    output->window_pos = 0U;
+
+    if ((addr = mmap(NULL, output->window_len, PROT_READ | PROT_WRITE, MAP_SHARED, output->fd, (off_t)output->file_offset)) == MAP_FAILED) {
+        return false;
+    }
+
+    output->window = (uint8_t*)addr;
+#ifdef MADV_SEQUENTIAL
+    madvise(addr, output->window_len, MADV_SEQUENTIAL);
+#endif
+    return true;
+}
+
+/* Unmap the current window, after initiating the write-back of its pages */
+static bool unmap_window(output_t *const output)
+{
+    const bool success = (msync(output->window, output->window_len, MS_ASYNC) == 0);
+    munmap(output->window, output->window_len);
+    output->file_offset += output->window_len;
+    output->window = NULL;
+    return success;
+}
+
+/* The mapping starts at the page containing "offset", and the window position is set to "offset" within it */
+static output_t *create_mapped(FILE *const stream, const uint64_t offset, const uint64_t size, const size_t window_size)
+{
+    output_t *output;
+    long page_size;
+
+    if (!(output = (output_t*)calloc(1U, sizeof(output_t)))) {
+        return NULL;
+    }
+
+    page_size = sysconf(_SC_PAGESIZE);
+    if (page_size < (long)OUTPUT_ALIGNMENT) {
+        page_size = (long)OUTPUT_ALIGNMENT;
+    }
+
+    output->mode = OUTPUT_MMAP;
+    output->stream = stream;
+    output->fd = fileno(stream);
+    output->capacity = ((window_size + (size_t)page_size - 1U) / ((size_t)page_size)) * ((size_t)page_size);
+    output->file_size = offset + size;
+    output->file_offset = offset - (offset % (uint64_t)page_size);
+
+    if ((!preallocate(output->fd, output->file_size)) || (size && (!map_window(output)))) {
+        free(output);
+        return NULL;
+    }
+
+    output->window_pos = (size_t)(offset - output->file_offset);
+    return output;
+}
+#endif
+
+/* Position an existing file at "offset", discarding anything after it; fails if the file is shorter than that */
+static bool seek_file(FILE *const stream, const uint64_t offset)
+{
+#ifdef _WIN32
+    const int fd = _fileno(stream);
+    const __int64 length = _filelengthi64(fd);
+    if ((offset > (uint64_t)INT64_MAX) || (length < 0) || (((uint64_t)length) < offset)) {
+        return false;
+    }
+    return (_chsize_s(fd, (__int64)offset) == 0) && (_fseeki64(stream, (__int64)offset, SEEK_SET) == 0);
+#else
+    const int fd = fileno(stream);
+    struct stat info;
+    if (((uint64_t)((off_t)offset) != offset) || (fstat(fd, &info) != 0) || (((uint64_t)info.st_size) < offset)) {
+        return false;
+    }
+    return (ftruncate(fd, (off_t)offset) == 0) && (fseeko(stream, (off_t)offset, SEEK_SET) == 0);
+#endif
+}
+
+/* ======================================================================== */
+/* Public functions                                                         */
+/* ======================================================================== */
+
+/* Create output engine for the given stream; the buffer size is rounded up to the next multiple of the page size */
+output_t *output_create(FILE *const stream, const size_t buffer_size)
+{
+    output_t *output;
+
+    if ((!buffer_size) || (buffer_size > SIZE_MAX - OUTPUT_ALIGNMENT)) {
+        return NULL;
+    }
+
+    if (!(output = (output_t*)calloc(1U, sizeof(output_t)))) {
+        return NULL;
+    }
+
+    output->stream = stream;
+    output->capacity = ((buffer_size + OUTPUT_ALIGNMENT - 1U) / OUTPUT_ALIGNMENT) * OUTPUT_ALIGNMENT;
+
+    for (output->buffer_count = 0U; output->buffer_count < OUTPUT_BUFFERS; ++output->buffer_count) {
+        if (!(output->buffers[output->buffer_count] = alloc_aligned(output->capacity))) {
+            output_destroy(output);
+            return NULL;
+        }
+    }
+
+    fflush(stream);
+
+#ifdef _WIN32
+    output->mode = OUTPUT_STDIO;
+    if (setvbuf(stream, NULL, _IONBF, 0U) != 0) {
+        output_destroy(output);
+        return NULL;
+    }
+#else
+    output->mode = OUTPUT_WRITE;
+    output->fd = fileno(stream);
+#endif
+
+    return output;
+}
+
+/*
+ * Hand the full buffers to the pipe with vmsplice(), instead of copying them with write(). Only safe if the
+ * reader copies the data out of the pipe (e.g. with read()): a reader that passes the pages on with splice()
+ * or tee() may see *later* output in place of the original data. Fails, if the output is not a pipe, or if
+ * vmsplice() is not supported; the output then keeps using write(). Must be called before the first commit.
+ */
+bool output_use_vmsplice(output_t *const output)
+{
+#if HAVE_VMSPLICE
+    if ((output->mode == OUTPUT_WRITE) && (!output->writer) && setup_vmsplice(output)) {
+        output->mode = OUTPUT_VMSPLICE;
+        return true;
+    }
+#else
+    (void)output;
+#endif
+    return false;
+}
+
+/*
+ * Create output engine for a file of the given size; UINT64_MAX means that the size is unknown. The file is
+ * preallocated and mapped into memory, one window of "buffer_size" bytes at a time, if the OS supports it.
+ * If "offset" is non-zero, the output continues an existing file at that offset, which must not exceed the
+ * length of the file; anything after the offset is discarded. Otherwise, the file is created or overwritten.
+ */
+output_t *output_create_file(const char *const path, const uint64_t offset, const uint64_t size, const size_t buffer_size)
+{
+    FILE *stream;
+    output_t *output;
+
+    if ((!buffer_size) || (buffer_size > SIZE_MAX - OUTPUT_ALIGNMENT) || ((size != UINT64_MAX) && (size > UINT64_MAX - offset - 1U))) {
+        return NULL;
+    }
+
+    if (!(stream = fopen(path, offset ? "r+b" : "w+b"))) {
+        return NULL;
+    }
+
+    if (offset && (!seek_file(stream, offset))) {
+        fclose(stream);
+        return NULL;
+    }
+
+#if HAVE_MMAP
+    if ((size != UINT64_MAX) && (output = create_mapped(stream, offset, size, buffer_size))) {
+        output->owns_stream = true;
+        return output;
+    }
+#endif
+
+    if (!(output = output_create(stream, buffer_size))) {
+        fclose(stream);
+        return NULL;
+    }
+
+    output->owns_stream = true;
+    return output;
+}
+
+/* Return the current buffer, of size output_capacity(), which is going to be written by the next output_commit() */
+uint8_t *output_buffer(output_t *const output)
+{
+    if (output->writer) {
+        acquire_async(output);
+        return output->buffers[output->current];
+    }
+#if HAVE_MMAP
+    if (output->mode == OUTPUT_MMAP) {
+        return output->window + output->window_pos;
+    }
+#endif
+    return output->buffers[output->current];
+}
+
+size_t output_capacity(const output_t *const output)
+{
+#if HAVE_MMAP
+    if ((!output->writer) && (output->mode == OUTPUT_MMAP)) {
+        return output->window_len - output->window_pos;
+    }
+#endif
+    return output->capacity;
+}
+
+/* Write the first "len" bytes of the current buffer; the buffer returned by output_buffer() may change */
+bool output_commit(output_t *const output, const size_t len)
+{
+    bool success = false, spliced = false;
+
+    if (output->writer) {
+        return commit_async(output, len);
+    }
+
+    switch (output->mode) {
+#if HAVE_MMAP
+    case OUTPUT_MMAP:
+        success = true;
+        if ((output->window_pos += len) >= output->window_len) {
+            success = unmap_window(output) && ((output->file_offset >= output->file_size) || map_window(output));
+        }
+        break;
+#endif
+    default:
+        if ((success = write_buffer(output, output->buffers[output->current], len, &spliced)) && spliced) {
+            output->current = (output->current + 1U) % OUTPUT_BUFFERS;
+        }
+        break;
+    }
+
+    return success;
+}
+
+/*
+ * Start the asynchronous writer thread, which drains a ring of "depth" buffers, so that the generation of the next
+ * buffers overlaps with the writing. output_buffer() only blocks while all buffers are queued. Has no effect if the
+ * output is a mapped file, which is written back by the OS asynchronously anyway.
+ */
+bool output_start_async(output_t *const output, const size_t depth)
+{
+    if ((depth < OUTPUT_BUFFERS) || (depth > OUTPUT_MAX_BUFFERS) || output->writer) {
+        return false;
+    }
+
+    if (output->mode == OUTPUT_MMAP) {
+        return true;
+    }
+
+    while (output->buffer_count < depth) {
+        if (!(output->buffers[output->buffer_count] = alloc_aligned(output->capacity))) {
+            return false;
+        }
+        ++output->buffer_count;
+    }
+
+    if (!(output->monitor = xxh64prng_os_monitor_create())) {
+        return false;
+    }
+
+    if (!(output->writer = xxh64prng_os_thread_create(writer_main, output))) {
+        xxh64prng_os_monitor_destroy(output->monitor);
+        output->monitor = NULL;
+        return false;
+    }
+
+    return true;
+}
+
+/* Wait until all committed buffers have been written; fails if any write has failed */
+bool output_flush(output_t *const output)
+{
+    bool success;
+
+    if (!output->writer) {
+        return true;
+    }
+
+    xxh64prng_os_monitor_enter(output->monitor);
+    while (output->written < output->submitted) {
+        xxh64prng_os_monitor_wait(output->monitor);
+    }
+    success = !output->failed;
+    xxh64prng_os_monitor_leave(output->monitor);
+
+    return success;
+}
+
+/*
+ * Cut the output file off after "size" bytes, e.g. after an interruption, when the (mapped) file has been
+ * preallocated to its full size. Must be called after output_flush(), no more output may be committed.
+ */
+bool output_truncate(output_t *const output, const uint64_t size)
+{
+    if (!output->owns_stream) {
+        return false;
+    }
+
+#if HAVE_MMAP
+    if (output->window) {
+        unmap_window(output);
+    }
+#endif
+
+#ifdef _WIN32
+    return (size <= (uint64_t)INT64_MAX) && (_chsize_s(_fileno(output->stream), (__int64)size) == 0);
+#else
+    return ((uint64_t)((off_t)size) == size) && (ftruncate(fileno(output->stream), (off_t)size) == 0);
+#endif
+}
+
+/* Get the number of write calls (system calls, or fwrite() calls) and how many of them have written less than requested */
+void output_stats(output_t *const output, uint64_t *const write_calls, uint64_t *const short_writes)
+{
+    if (output->writer) {
+        xxh64prng_os_monitor_enter(output->monitor);
+        *write_calls = output->reported_calls;
+        *short_writes = output->reported_short;
+        xxh64prng_os_monitor_leave(output->monitor);
+        return;
+    }
+
+    *write_calls = output->write_calls;
+    *short_writes = output->short_writes;
+}
+
+/* Destroy output engine and wipe the buffers */
+void output_destroy(output_t *const output)
+{
+    size_t index;
+
+    if (!output) {
+        return;
+    }
+
+    if (output->writer) {
+        xxh64prng_os_monitor_enter(output->monitor);
+        output->shutdown = true;
+        xxh64prng_os_monitor_notify(output->monitor);
+        xxh64prng_os_monitor_leave(output->monitor);
+        xxh64prng_os_thread_join(output->writer);
+        xxh64prng_os_monitor_destroy(output->monitor);
+    }
+
+#if HAVE_MMAP
+    if (output->window) {
+        unmap_window(output);
+    }
+#endif
+
+    for (index = 0U; index < output->buffer_count; ++index) {
+        if (output->buffers[index]) {
+            if (output->mode != OUTPUT_VMSPLICE) { /* pages may still be referenced by the pipe! */
+                xxh64prng_zero(output->buffers[index], output->capacity);
+            }
+            free_aligned(output->buffers[index]);
+        }
+    }
+
+    if (output->owns_stream) {
+        fclose(output->stream);
+    }
+
+    xxh64prng_zero(output, sizeof(output_t));
+    free(output);
+}
@@ -0,0 +1,63 @@
+/*
+ * XXH64-PRNG
+ * Blazing fast XXH64-based secure pseudo-random number generator
+ *
+ * Copyright (c) 2025 "dEajL3kA" <Cumpoing79@web.de>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * https://www.opensource.org/licenses/bsd-license.php
+ */
+
+#ifndef _XXH_RAND_OUTPUT_H
+#define _XXH_RAND_OUTPUT_H
+
+#include <xxh64_prng.h>
+#include <stdio.h>
+
+/* output engine (opaque) */
+typedef struct output output_t;
+
+/* create/destroy */
+output_t *output_create(FILE *const stream, const size_t buffer_size);
+output_t *output_create_file(const char *const path, const uint64_t offset, const uint64_t size, const size_t buffer_size);
+void output_destroy(output_t *const output);
+
+/* buffer management */
+uint8_t *output_buffer(output_t *const output);
+size_t output_capacity(const output_t *const output);
+bool output_commit(output_t *const output, const size_t len);
+
+/* zero-copy writing to a pipe (opt-in) */
+bool output_use_vmsplice(output_t *const output);
+
+/* asynchronous writing */
+bool output_start_async(output_t *const output, const size_t depth);
+bool output_flush(output_t *const output);
+
+/* files only */
+bool output_truncate(output_t *const output, const uint64_t size);
+
+/* statistics */
+void output_stats(output_t *const output, uint64_t *const write_calls, uint64_t *const short_writes);
+
+#endif /*_XXH_RAND_OUTPUT_H*/
@@ -0,0 +1,212 @@
+/*
+ * XXH64-PRNG
+ * Blazing fast XXH64-based secure pseudo-random number generator
+ *
+ * Copyright (c) 2025 "dEajL3kA" <Cumpoing79@web.de>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * https://www.opensource.org/licenses/bsd-license.php
+ */
+
+#include "stats.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#ifdef _WIN32
+#  define WIN32_LEAN_AND_MEAN 1
+#  include <windows.h>
+#else
+#  include <time.h>
+#  include <unistd.h>
+#endif
+
+#if defined(__linux__)
+#  include <linux/perf_event.h>
+#  include <sys/ioctl.h>
+#  include <sys/syscall.h>
+#endif
+
+#if defined(__linux__) && defined(SYS_perf_event_open)
+#  define HAVE_PERF_EVENTS 1
+#else
+#  define HAVE_PERF_EVENTS 0
+#endif
+
+#define GIGA 1.0e9
+
+struct stats {
+    double interval, start, last_report;
+    double generate_time, encode_time, write_time;
+    uint64_t bytes;
+    xxh64prng_stats_t counters; /* updated by the library */
+#if HAVE_PERF_EVENTS
+    int perf_cycles, perf_instructions;
+#endif
+};
+
+/* ======================================================================== */
+/* Hardware performance counters                                            */
+/* ======================================================================== */
+
+#if HAVE_PERF_EVENTS
+/* Count user-space events of the calling thread and all threads that it creates afterwards, returns -1 if not available */
+static int perf_open(const uint64_t config)
+{
+    struct perf_event_attr attr;
+
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.config = config;
+    attr.exclude_kernel = 1U;
+    attr.exclude_hv = 1U;
+    attr.inherit = 1U;
+
+    return (int)syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0UL);
+}
+
+/* Read a counter, including the threads that have inherited it */
+static bool perf_read(const int fd, uint64_t *const value)
+{
+    return (fd >= 0) && (read(fd, value, sizeof(uint64_t)) == (ssize_t)sizeof(uint64_t));
+}
+#endif
+
+/* ======================================================================== */
+/* Statistics                                                               */
+/* ======================================================================== */
+
+stats_t *stats_create(const double interval)
+{
+    stats_t *const stats = (stats_t*)calloc(1U, sizeof(stats_t));
+    if (!stats) {
+        return NULL;
+    }
+
+    stats->interval = interval;
+#if HAVE_PERF_EVENTS
+    stats->perf_cycles = perf_open(PERF_COUNT_HW_CPU_CYCLES);
+    stats->perf_instructions = perf_open(PERF_COUNT_HW_INSTRUCTIONS);
+#endif
+
+    xxh64prng_set_stats(&stats->counters);
+    stats->start = stats->last_report = stats_clock(stats);
+    return stats;
+}
+
+void stats_destroy(stats_t *const stats)
+{
+    if (!stats) {
+        return;
+    }
+
+    xxh64prng_set_stats(NULL);
+#if HAVE_PERF_EVENTS
+    if (stats->perf_cycles >= 0) {
+        close(stats->perf_cycles);
+    }
+    if (stats->perf_instructions >= 0) {
+        close(stats->perf_instructions);
+    }
+#endif
+
+    free(stats);
+}
+
+double stats_clock(const stats_t *const stats)
+{
+#ifdef _WIN32
+    LARGE_INTEGER counter, frequency;
+    if ((!stats) || (!QueryPerformanceCounter(&counter)) || (!QueryPerformanceFrequency(&frequency))) {
+        return 0.0;
+    }
+    return ((double)counter.QuadPart) / ((double)frequency.QuadPart);
+#else
+    struct timespec now;
+    if ((!stats) || (clock_gettime(CLOCK_MONOTONIC, &now) != 0)) {
+        return 0.0;
+    }
+    return ((double)now.tv_sec) + (((double)now.tv_nsec) / GIGA);
+#endif
+}
+
+void stats_account(stats_t *const stats, const uint64_t bytes, const double generate_time, const double encode_time, const double write_time)
+{
+    if (!stats) {
+        return;
+    }
+
+    stats->bytes += bytes;
+    stats->generate_time += generate_time;
+    stats->encode_time += encode_time;
+    stats->write_time += write_time;
+}
+
+static double percent(const double part, const double total)
+{
+    return (total > 0.0) ? ((100.0 * part) / total) : 0.0;
+}
+
+void stats_report(stats_t *const stats, output_t *const output, const bool final)
+{
+    xxh64prng_stats_t counters;
+    uint64_t write_calls = 0U, short_writes = 0U;
+    double now, elapsed;
+#if HAVE_PERF_EVENTS
+    uint64_t cycles, instructions;
+#endif
+
+    if (!stats) {
+        return;
+    }
+
+    now = stats_clock(stats);
+    if (!final) {
+        if ((stats->interval <= 0.0) || ((now - stats->last_report) < stats->interval)) {
+            return;
+        }
+        stats->last_report = now;
+    }
+
+    elapsed = now - stats->start;
+    xxh64prng_get_stats(&counters);
+    if (output) {
+        output_stats(output, &write_calls, &short_writes);
+    }
+
+    fprintf(stderr, "Stats%s: %llu bytes, %llu blocks in %.3f s (%.3f GB/s)\n", final ? "" : " (running)",
+        (unsigned long long)stats->bytes, (unsigned long long)counters.blocks, elapsed, (elapsed > 0.0) ? (((double)stats->bytes) / elapsed / GIGA) : 0.0);
+    fprintf(stderr, "  generate: %.3f s (%.1f%%), encode: %.3f s (%.1f%%), write: %.3f s (%.1f%%)\n",
+        stats->generate_time, percent(stats->generate_time, elapsed), stats->encode_time, percent(stats->encode_time, elapsed), stats->write_time, percent(stats->write_time, elapsed));
+    fprintf(stderr, "  write calls: %llu, short writes: %llu\n", (unsigned long long)write_calls, (unsigned long long)short_writes);
+    fprintf(stderr, "  state steps: %llu, re-hash retries: %llu\n", (unsigned long long)counters.steps, (unsigned long long)counters.retries);
+
+#if HAVE_PERF_EVENTS
+    if (perf_read(stats->perf_cycles, &cycles) && perf_read(stats->perf_instructions, &instructions)) {
+        fprintf(stderr, "  cycles: %llu, instructions: %llu, IPC: %.2f\n", (unsigned long long)cycles, (unsigned long long)instructions, cycles ? (((double)instructions) / ((double)cycles)) : 0.0);
+        return;
+    }
+#endif
+    fputs("  cycles, instructions: not available\n", stderr);
+}
@@ -0,0 +1,53 @@
+/*
+ * XXH64-PRNG
+ * Blazing fast XXH64-based secure pseudo-random number generator
+ *
+ * Copyright (c) 2025 "dEajL3kA" <Cumpoing79@web.de>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * https://www.opensource.org/licenses/bsd-license.php
+ */
+
+#ifndef _XXH_RAND_STATS_H
+#define _XXH_RAND_STATS_H
+
+#include <xxh64_prng.h>
+#include "output.h"
+
+/* statistics collector (opaque), all functions accept NULL and do nothing in that case */
+typedef struct stats stats_t;
+
+/* create/destroy; "interval" is the time between periodic reports, in seconds (0 = final report only); destroy only after all generating threads have finished */
+stats_t *stats_create(const double interval);
+void stats_destroy(stats_t *const stats);
+
+/* monotonic clock, in seconds; returns 0 if "stats" is NULL */
+double stats_clock(const stats_t *const stats);
+
+/* account for a chunk of "bytes" generated bytes and the time spent on each phase */
+void stats_account(stats_t *const stats, const uint64_t bytes, const double generate_time, const double encode_time, const double write_time);
+
+/* print a periodic report to the standard error, if it is due, or the final report */
+void stats_report(stats_t *const stats, output_t *const output, const bool final);
+
+#endif /*_XXH_RAND_STATS_H*/
@@ -0,0 +1,41 @@
+#!/usr/bin/env python3
+#
+# Copies stdin to stdout like "cat", but moves the data with splice() through
+# an intermediate pipe, which is only drained once it is almost full. So the
+# pages of the input pipe stay referenced long after they have been consumed,
+# which reveals a writer that reuses buffers that are still in flight.
+#
+
+import fcntl
+import os
+import sys
+
+F_SETPIPE_SZ = 1031
+HOLD_BYTES = 768 << 10
+
+def main():
+    inner_r, inner_w = os.pipe()
+    fcntl.fcntl(inner_w, F_SETPIPE_SZ, 1 << 20)
+    out = sys.stdout.buffer
+    pending = 0
+
+    def drain():
+        nonlocal pending
+        while pending:
+            data = os.read(inner_r, min(pending, 1 << 16))
+            out.write(data)
+            pending -= len(data)
+
+    while True:
+        count = os.splice(sys.stdin.fileno(), inner_w, 1 << 16)
+        if not count:
+            break
+        pending += count
+        if pending >= HOLD_BYTES:
+            drain()
+
+    drain()
+    out.flush()
+
+if __name__ == "__main__":
+    main()
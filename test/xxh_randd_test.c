@@ -0,0 +1,275 @@
+/*
+ * XXH64-PRNG
+ * Blazing fast XXH64-based secure pseudo-random number generator
+ *
+ * Copyright (c) 2025 "dEajL3kA" <Cumpoing79@web.de>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * https://www.opensource.org/licenses/bsd-license.php
+ */
+
+#include <xxh64_prng.h>
+
+#include <stdio.h>
+#include <string.h>
+
+#include <xxh_randd.h>
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+
+/* the seed is passed to the daemon as a string, so both must match */
+#define TEST_SEED 12345U
+#define TEST_SEED_STR "12345"
+
+/* more than one ring per client, and not a multiple of the block size */
+#define SHM_BYTES ((3U * XXH_RANDD_RING_BLOCKS * XXH64PRNG_OUTPUT_BYTES) + 123U)
+#define SHM_CHUNK 7777U
+
+/* bytes read by the parent after a child process has tried to use the inherited client */
+#define FORK_BYTES (2U * XXH_RANDD_RING_BLOCKS * XXH64PRNG_OUTPUT_BYTES)
+
+/* pipelined socket requests, including an empty one */
+#define SOCKET_REQUEST "1000\n0\n2345\n17\n"
+#define SOCKET_BYTES (1000U + 2345U + 17U)
+
+/* the stream IDs are assigned by the daemon, in order */
+#define MAX_IDS 64U
+
+/* time to wait for the daemon to come up */
+#define STARTUP_ROUNDS 500U
+#define STARTUP_DELAY 10000U
+
+/* a client that waits forever is a failure, too (seconds) */
+#define TEST_TIMEOUT 60U
+
+static size_t failures = 0U;
+static volatile pid_t daemon_pid = -1;
+
+#define CHECK(COND, ...) do { \
+    if (!(COND)) { \
+        printf("FAILED: " __VA_ARGS__); \
+        putchar('\n'); \
+        ++failures; \
+    } \
+} while(0)
+
+/* Compute the first "len" bytes of the stream that the daemon derives for "id" */
+static void expected_bytes(const xxh64prng_t *const master, const uint64_t id, uint8_t *const out, const size_t len)
+{
+    xxh64prng_t state;
+    xxh64prng_stream_t stream;
+
+    xxh64prng_derive(&state, master, id);
+    xxh64prng_stream_init(&stream, &state);
+    xxh64prng_fill(&stream, out, len);
+}
+
+/* Start the daemon on private names, returns its PID or -1 on failure */
+static pid_t daemon_start(const char *const path, const char *const shm_name, const char *const socket_path)
+{
+    const pid_t pid = fork();
+
+    if (pid == 0) {
+        execl(path, path, "--shm", shm_name, "--socket", socket_path, "--slots", "2", "--seed", TEST_SEED_STR, (char*)NULL);
+        _exit(127);
+    }
+
+    return pid;
+}
+
+/* Check whether the daemon is still running */
+static bool daemon_alive(const pid_t pid)
+{
+    int status;
+    return waitpid(pid, &status, WNOHANG) == 0;
+}
+
+/* Stop the daemon and fail, if the test hangs */
+static void timeout_handler(const int sig)
+{
+    static const char MESSAGE[] = "FAILED: timeout, the test hangs\n";
+    (void)sig;
+    if (daemon_pid > 0) {
+        kill(daemon_pid, SIGTERM);
+    }
+    if (write(STDOUT_FILENO, MESSAGE, sizeof(MESSAGE) - 1U) < 0) {
+        _exit(EXIT_FAILURE);
+    }
+    _exit(EXIT_FAILURE);
+}
+
+/* Stop the daemon, it must shut down cleanly */
+static void daemon_stop(const pid_t pid)
+{
+    int status;
+
+    kill(pid, SIGTERM);
+    CHECK((waitpid(pid, &status, 0) == pid) && WIFEXITED(status) && (WEXITSTATUS(status) == 0), "daemon exit status");
+}
+
+/* ======================================================================== */
+/* Shared-memory clients                                                    */
+/* ======================================================================== */
+
+static void test_shm(const xxh64prng_t *const master, const pid_t pid, const char *const shm_name)
+{
+    static uint8_t actual[2U][SHM_BYTES + FORK_BYTES], expected[SHM_BYTES + FORK_BYTES];
+    xxh_randd_client_t clients[2U];
+    size_t index, pos, rounds;
+    pid_t child;
+    int status;
+
+    for (rounds = 0U; (!xxh_randd_attach(&clients[0U], shm_name)) && (rounds < STARTUP_ROUNDS) && daemon_alive(pid); ++rounds) {
+        usleep(STARTUP_DELAY);
+    }
+
+    CHECK(clients[0U].slot != NULL, "xxh_randd_attach(), first client");
+    CHECK(xxh_randd_attach(&clients[1U], shm_name), "xxh_randd_attach(), second client");
+    if ((!clients[0U].slot) || (!clients[1U].slot)) {
+        xxh_randd_detach(&clients[1U]);
+        xxh_randd_detach(&clients[0U]);
+        return;
+    }
+
+    CHECK(clients[0U].slot->stream_id != clients[1U].slot->stream_id, "shm clients must get different streams");
+
+    /* interleaved reads, so that both rings are refilled while the other client is reading */
+    for (pos = 0U; pos < SHM_BYTES; pos += SHM_CHUNK) {
+        const size_t chunk_size = ((SHM_BYTES - pos) < SHM_CHUNK) ? (SHM_BYTES - pos) : SHM_CHUNK;
+        for (index = 0U; index < 2U; ++index) {
+            CHECK(xxh_randd_read(&clients[index], actual[index] + pos, chunk_size), "xxh_randd_read(), client %u", (unsigned)index);
+        }
+    }
+
+    for (index = 0U; index < 2U; ++index) {
+        expected_bytes(master, clients[index].slot->stream_id, expected, SHM_BYTES);
+        CHECK(!memcmp(actual[index], expected, SHM_BYTES), "shm client %u, output must match xxh64prng_derive(%llu)", (unsigned)index, (unsigned long long)clients[index].slot->stream_id);
+    }
+
+    /* a child process must neither read from the inherited client, nor release the parent's slot */
+    if ((child = fork()) == 0) {
+        const bool success = xxh_randd_read(&clients[0U], actual[0U], 1U);
+        xxh_randd_detach(&clients[0U]);
+        _exit(success ? 1 : 0);
+    }
+    CHECK((child > 0) && (waitpid(child, &status, 0) == child) && WIFEXITED(status) && (WEXITSTATUS(status) == 0), "xxh_randd_read() must fail in a child process");
+    usleep(STARTUP_DELAY); /* give the daemon a chance to reclaim the slot, which it must not do */
+    CHECK(__atomic_load_n(clients[0U].state, __ATOMIC_ACQUIRE) == XXH_RANDD_STATE(getpid(), XXH_RANDD_SLOT_ATTACHED), "xxh_randd_detach() in a child process must keep the parent's slot");
+
+    CHECK(xxh_randd_read(&clients[0U], actual[0U] + SHM_BYTES, FORK_BYTES), "xxh_randd_read(), after fork()");
+    expected_bytes(master, clients[0U].slot->stream_id, expected, SHM_BYTES + FORK_BYTES);
+    CHECK(!memcmp(actual[0U] + SHM_BYTES, expected + SHM_BYTES, FORK_BYTES), "shm client 0, output must continue after fork()");
+
+    xxh_randd_detach(&clients[1U]);
+    xxh_randd_detach(&clients[0U]);
+}
+
+/* ======================================================================== */
+/* Socket clients                                                           */
+/* ======================================================================== */
+
+static void test_socket(const xxh64prng_t *const master, const char *const socket_path)
+{
+    static uint8_t actual[SOCKET_BYTES + 1024U], expected[SOCKET_BYTES];
+    struct sockaddr_un addr;
+    size_t total = 0U, rounds;
+    ssize_t len;
+    uint64_t id;
+    bool found = false;
+
+    const int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    CHECK(fd >= 0, "socket()");
+    if (fd < 0) {
+        return;
+    }
+
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strncpy(addr.sun_path, socket_path, sizeof(addr.sun_path) - 1U);
+
+    for (rounds = 0U; (connect(fd, (const struct sockaddr*)&addr, sizeof(addr)) != 0) && (rounds < STARTUP_ROUNDS); ++rounds) {
+        usleep(STARTUP_DELAY);
+    }
+
+    /* all requests in a single write, then no more requests */
+    CHECK(write(fd, SOCKET_REQUEST, strlen(SOCKET_REQUEST)) == (ssize_t)strlen(SOCKET_REQUEST), "socket, write()");
+    shutdown(fd, SHUT_WR);
+
+    while ((len = read(fd, actual + total, sizeof(actual) - total)) > 0) {
+        total += (size_t)len;
+    }
+
+    close(fd);
+    CHECK(total == SOCKET_BYTES, "socket, expected %u bytes, received %u", (unsigned)SOCKET_BYTES, (unsigned)total);
+
+    for (id = 0U; (id < MAX_IDS) && (!found) && (total == SOCKET_BYTES); ++id) {
+        expected_bytes(master, id, expected, SOCKET_BYTES);
+        found = !memcmp(actual, expected, SOCKET_BYTES);
+    }
+
+    CHECK(found, "socket, output must match a derived stream");
+}
+
+/* ======================================================================== */
+/* MAIN                                                                     */
+/* ======================================================================== */
+
+int main(int argc, char *argv[])
+{
+    char shm_name[64U], socket_path[64U];
+    xxh64prng_t master;
+    pid_t pid;
+
+    if (argc < 2) {
+        puts("Usage: xxh_randd_test PATH_TO_DAEMON");
+        return EXIT_FAILURE;
+    }
+
+    snprintf(shm_name, sizeof(shm_name), "/xxh_randd_test.%ld", (long)getpid());
+    snprintf(socket_path, sizeof(socket_path), "/tmp/xxh_randd_test.%ld.sock", (long)getpid());
+
+    if ((pid = daemon_start(argv[1], shm_name, socket_path)) < 0) {
+        puts("FAILED: fork()");
+        return EXIT_FAILURE;
+    }
+
+    daemon_pid = pid;
+    signal(SIGALRM, timeout_handler);
+    alarm(TEST_TIMEOUT);
+
+    xxh64prng_init(&master, TEST_SEED);
+
+    test_shm(&master, pid, shm_name);
+    test_socket(&master, socket_path);
+    daemon_stop(pid);
+
+    if (failures) {
+        printf("\n%u check(s) have FAILED !!!\n", (unsigned)failures);
+        return EXIT_FAILURE;
+    }
+
+    puts("All daemon tests passed.");
+    return EXIT_SUCCESS;
+}
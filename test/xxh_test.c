@@ -0,0 +1,992 @@
+/*
+ * XXH64-PRNG
+ * Blazing fast XXH64-based secure pseudo-random number generator
+ *
+ * Copyright (c) 2025 "dEajL3kA" <Cumpoing79@web.de>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * https://www.opensource.org/licenses/bsd-license.php
+ */
+
+#include <xxh64_prng.h>
+
+#include "xxh64.h"
+#include "xxh64_simd.h"
+#include "xxh64_prng_core.h"
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#ifndef _WIN32
+#  include <unistd.h>
+#  include <sys/wait.h>
+#endif
+
+#if !ENABLE_TEST_HOOKS
+#  error This test must be built with ENABLE_TEST_HOOKS=1
+#endif
+
+/* number of blocks covered by the "next" vectors */
+#define NEXT_BLOCKS 8U
+
+/* size of the data used for the cross-checks between implementations */
+#define CROSS_BLOCKS 64U
+#define CROSS_BYTES (CROSS_BLOCKS * XXH64PRNG_OUTPUT_BYTES)
+
+/* number of values used for the cross-checks of the distributions: more than two chunks, and not a multiple of the vector width */
+#define CROSS_VALUES 2501U
+
+/* number of values used for the statistical checks of the distributions */
+#define DIST_VALUES 1000000U
+
+/* ======================================================================== */
+/* Known-answer vectors                                                     */
+/* ======================================================================== */
+
+/*
+ * The vectors have been computed with an independent model of the generator,
+ * written in Python on top of the "xxhash" package.
+ */
+
+typedef struct { size_t length; uint64_t seed; uint64_t digest; } xxh64_vector_t;
+typedef struct { uint64_t seed; uint64_t state[_XXH64PRNG_STATE_WORDS]; } init_vector_t;
+typedef struct { uint64_t seed; uint64_t digest; uint64_t state[_XXH64PRNG_STATE_WORDS]; } next_vector_t;
+typedef struct { uint64_t seed; size_t retries; uint64_t digest; } retry_vector_t;
+typedef struct { uint64_t id; uint64_t state[_XXH64PRNG_STATE_WORDS]; } derive_vector_t;
+typedef struct { uint64_t index; uint64_t digest; } counter_vector_t;
+
+/* XXH64() of the first "length" bytes of the sanity buffer */
+static const xxh64_vector_t XXH64_VECTORS[] = {
+    {   0U, UINT64_C(0x0000000000000000), UINT64_C(0xEF46DB3751D8E999) },
+    {   0U, UINT64_C(0x000000009E3779B1), UINT64_C(0xAC75FDA2929B17EF) },
+    {   0U, UINT64_C(0x9E3779B185EBCA8D), UINT64_C(0x0B303D920EC349DF) },
+    {   1U, UINT64_C(0x0000000000000000), UINT64_C(0xE934A84ADB052768) },
+    {   1U, UINT64_C(0x000000009E3779B1), UINT64_C(0x5014607643A9B4C3) },
+    {   1U, UINT64_C(0x9E3779B185EBCA8D), UINT64_C(0x9C6678669FCD2E6D) },
+    {   3U, UINT64_C(0x0000000000000000), UINT64_C(0xFF7E1959CB50794A) },
+    {   3U, UINT64_C(0x000000009E3779B1), UINT64_C(0xAA8584E83660F7D1) },
+    {   3U, UINT64_C(0x9E3779B185EBCA8D), UINT64_C(0x281B7CBB86CC6A05) },
+    {   4U, UINT64_C(0x0000000000000000), UINT64_C(0x9136A0DCA57457EE) },
+    {   4U, UINT64_C(0x000000009E3779B1), UINT64_C(0xCAAB286BD8E9FDB5) },
+    {   4U, UINT64_C(0x9E3779B185EBCA8D), UINT64_C(0xCCFE4EAD7E01983C) },
+    {   8U, UINT64_C(0x0000000000000000), UINT64_C(0xCDBCF538E71D1348) },
+    {   8U, UINT64_C(0x000000009E3779B1), UINT64_C(0xFE0C047A5353CDAC) },
+    {   8U, UINT64_C(0x9E3779B185EBCA8D), UINT64_C(0x768161B4E5A58DFA) },
+    {  14U, UINT64_C(0x0000000000000000), UINT64_C(0x8282DCC4994E35C8) },
+    {  14U, UINT64_C(0x000000009E3779B1), UINT64_C(0xC3BD6BF63DEB6DF0) },
+    {  14U, UINT64_C(0x9E3779B185EBCA8D), UINT64_C(0x12DCD5DB160CC92B) },
+    {  31U, UINT64_C(0x0000000000000000), UINT64_C(0x299B39A290E6D783) },
+    {  31U, UINT64_C(0x000000009E3779B1), UINT64_C(0xDA673D5FEB5C1D79) },
+    {  31U, UINT64_C(0x9E3779B185EBCA8D), UINT64_C(0x51AAF1A336575F00) },
+    {  32U, UINT64_C(0x0000000000000000), UINT64_C(0x18B216492BB44B70) },
+    {  32U, UINT64_C(0x000000009E3779B1), UINT64_C(0xB3F33BDF93ADE409) },
+    {  32U, UINT64_C(0x9E3779B185EBCA8D), UINT64_C(0x21D817283F4B6283) },
+    {  33U, UINT64_C(0x0000000000000000), UINT64_C(0x55C8DC3E578F5B59) },
+    {  33U, UINT64_C(0x000000009E3779B1), UINT64_C(0xE92C292F64BC3071) },
+    {  33U, UINT64_C(0x9E3779B185EBCA8D), UINT64_C(0xB09782549294DF85) },
+    {  63U, UINT64_C(0x0000000000000000), UINT64_C(0xA9EFBE0FA0F3F4E7) },
+    {  63U, UINT64_C(0x000000009E3779B1), UINT64_C(0x6C911FADB05B6FC2) },
+    {  63U, UINT64_C(0x9E3779B185EBCA8D), UINT64_C(0x34C3933DC0040446) },
+    {  64U, UINT64_C(0x0000000000000000), UINT64_C(0xEF558F8ACAC2B5CD) },
+    {  64U, UINT64_C(0x000000009E3779B1), UINT64_C(0xB5EEBA99264CC44F) },
+    {  64U, UINT64_C(0x9E3779B185EBCA8D), UINT64_C(0xF90D26FED8023D61) },
+    {  65U, UINT64_C(0x0000000000000000), UINT64_C(0xDE0F20DC2631AF7A) },
+    {  65U, UINT64_C(0x000000009E3779B1), UINT64_C(0xD3F6FF3941E310CA) },
+    {  65U, UINT64_C(0x9E3779B185EBCA8D), UINT64_C(0x7814174CD6405BEE) },
+    { 100U, UINT64_C(0x0000000000000000), UINT64_C(0x4BFE019CD91D9EA4) },
+    { 100U, UINT64_C(0x000000009E3779B1), UINT64_C(0x4853706DC9625CAE) },
+    { 100U, UINT64_C(0x9E3779B185EBCA8D), UINT64_C(0x38F1D4AABFD12D0F) },
+    { 222U, UINT64_C(0x0000000000000000), UINT64_C(0xB641AE8CB691C174) },
+    { 222U, UINT64_C(0x000000009E3779B1), UINT64_C(0x20CB8AB7AE10C14A) },
+    { 222U, UINT64_C(0x9E3779B185EBCA8D), UINT64_C(0xCCB064AC93EBB562) },
+};
+
+/* State after xxh64prng_init() */
+static const init_vector_t INIT_VECTORS[] = {
+    { UINT64_C(0x0000000000000000), {
+        UINT64_C(0xB2BCA66A1F4AFDAE), UINT64_C(0x8E7326A8E90FF0E1), UINT64_C(0x65BBFD87E35BE124), UINT64_C(0xBD380C866A2E990E),
+        UINT64_C(0x0E1227055AC06DED), UINT64_C(0x80001CE06E0905A3), UINT64_C(0x7024A11C7014B0B3), UINT64_C(0xCC1D8592E170BB97) } },
+    { UINT64_C(0x0000000000000001), {
+        UINT64_C(0x482F161B4BC463E2), UINT64_C(0xCB831C646702BCCD), UINT64_C(0xABA5635766F6968B), UINT64_C(0x6DF0B572C8CF11C6),
+        UINT64_C(0x7DE8DAD943ACD248), UINT64_C(0xB8CA840C2EF4C7B3), UINT64_C(0xABB9BAF6E8389695), UINT64_C(0x389BD85663835A01) } },
+    { UINT64_C(0x0000000000000002), {
+        UINT64_C(0xE33CEB4AB7240192), UINT64_C(0x375FA49F2B716C52), UINT64_C(0x47C90AEAAB53E1A0), UINT64_C(0x2F513622041CEAEB),
+        UINT64_C(0xE72AFD368DFAA9B6), UINT64_C(0xF147ED156D2C8F0E), UINT64_C(0x65B36D0AEC8B3AF1), UINT64_C(0x9FD98BBA41FFD074) } },
+    { UINT64_C(0x000000000000002A), {
+        UINT64_C(0xB103670505058DC2), UINT64_C(0x0756EACC47D60E4F), UINT64_C(0x710DCF32DA772717), UINT64_C(0x7C9C0AF6A5EA5553),
+        UINT64_C(0xC6499645843544AA), UINT64_C(0x1E94598ABE148DC2), UINT64_C(0xBC8FEB601E0B0B7B), UINT64_C(0x93CDAD92B2E4EC09) } },
+    { UINT64_C(0xFFFFFFFFFFFFFFFF), {
+        UINT64_C(0x5CFDE7EB28368881), UINT64_C(0x1660E04898FC9FDC), UINT64_C(0x45C8FC79BD50F367), UINT64_C(0x9432FD5E358DB680),
+        UINT64_C(0x733A827C4F928D74), UINT64_C(0x501E2BB150EAC5D5), UINT64_C(0x25C10328EE2DD540), UINT64_C(0x201F1349D84A8F11) } },
+};
+
+/* Digest of the first NEXT_BLOCKS blocks from xxh64prng_next(), and the state afterwards */
+static const next_vector_t NEXT_VECTORS[] = {
+    { UINT64_C(0x0000000000000000), UINT64_C(0x151C50DAB2F0ED27), {
+        UINT64_C(0x531886588F25915F), UINT64_C(0xEF366EA48779EF00), UINT64_C(0xC94BC438F1DB4DD3), UINT64_C(0x4DB0CDD1AE096F6F),
+        UINT64_C(0x3DD28FFBDDDA0584), UINT64_C(0x36C8A8A1E3C0FEBD), UINT64_C(0x5EEF2A732E51D966), UINT64_C(0xB8C9B3AA9CC93580) } },
+    { UINT64_C(0x0000000000000001), UINT64_C(0xAB55EF0EB14949BA), {
+        UINT64_C(0x98758B250A619FF7), UINT64_C(0x1C6DA7E1872FBEE4), UINT64_C(0x522185FE46621BAD), UINT64_C(0x5F94A8ED53FE63F5),
+        UINT64_C(0x06A493801DDF991A), UINT64_C(0xEC85EB0924ED9EB1), UINT64_C(0x4DECCD658947634A), UINT64_C(0xEAADADDB7EB660C5) } },
+    { UINT64_C(0x0000000000000002), UINT64_C(0x6C0140814C94840B), {
+        UINT64_C(0xA0D22080DA30FEC9), UINT64_C(0x90A1C839089CE389), UINT64_C(0x783EA948ED95D977), UINT64_C(0x1B6D9A77799DA875),
+        UINT64_C(0x09882BE213823504), UINT64_C(0xA39E89CA22AB4CE7), UINT64_C(0x47C913241AA4E864), UINT64_C(0x8731CD52439D83D3) } },
+    { UINT64_C(0x000000000000002A), UINT64_C(0x2255E654870747D2), {
+        UINT64_C(0xA12CC5B675E2EE21), UINT64_C(0x67E5506AB0AFEB97), UINT64_C(0x94FFB56ECDDD9D10), UINT64_C(0x365FCBDD8B4B5764),
+        UINT64_C(0xDC351F9487DDAC7A), UINT64_C(0x50856B791053F48E), UINT64_C(0x2BAE510E846A22F1), UINT64_C(0x9EB8F5AAD6CB0CDB) } },
+    { UINT64_C(0xFFFFFFFFFFFFFFFF), UINT64_C(0x546DAECF72D0A38B), {
+        UINT64_C(0x696E35E8F48F8E41), UINT64_C(0xECBB4C5D43FC0548), UINT64_C(0x534217746C24CAC9), UINT64_C(0x9CB445FAAC642238),
+        UINT64_C(0xE0CEB0E6D62FA634), UINT64_C(0xAB3B5718C0EFC14B), UINT64_C(0x062BFD112BAFE135), UINT64_C(0x490ABC78080A2B9F) } },
+};
+
+/* Digest of the first block, with the re-hash loop of the first step forced to repeat "retries" times */
+static const retry_vector_t RETRY_VECTORS[] = {
+    { UINT64_C(0x0000000000000001), 1U, UINT64_C(0xA258D8CFC6307E00) },
+    { UINT64_C(0x0000000000000001), 2U, UINT64_C(0xC9ACD365E77E4A26) },
+    { UINT64_C(0x000000000000002A), 5U, UINT64_C(0x0EB3B98071961FEF) },
+};
+
+/* Child states from xxh64prng_derive(), parent initialized with seed 42 */
+static const derive_vector_t DERIVE_VECTORS[] = {
+    { UINT64_C(0x0000000000000000), {
+        UINT64_C(0x4ED2B9619BAD77E3), UINT64_C(0x2519981CA990542B), UINT64_C(0xBEE4647293FCA84E), UINT64_C(0x82318ED68872E4FE),
+        UINT64_C(0xC3DA3DF98771CA57), UINT64_C(0xEF594C67E2AD132C), UINT64_C(0x0F360E4E2A1CB210), UINT64_C(0xA316959E87F39143) } },
+    { UINT64_C(0x0000000000000001), {
+        UINT64_C(0x49378606C3181267), UINT64_C(0x28437FD24556112A), UINT64_C(0x6FFA4A14A30D33D9), UINT64_C(0x12E9BEC96E95F594),
+        UINT64_C(0xC34524588E288B74), UINT64_C(0x16BC81DD7940A470), UINT64_C(0x7525298E32121EE3), UINT64_C(0xA70C72AB452A9904) } },
+    { UINT64_C(0x00000000000003E8), {
+        UINT64_C(0x9C711457CB764624), UINT64_C(0xE89520C313F70B1C), UINT64_C(0xC8BBD10D75BFB2D0), UINT64_C(0x138A07039B3993D7),
+        UINT64_C(0x79B9286218664C9A), UINT64_C(0x7A3B2EC6E2555A94), UINT64_C(0x329EC40DF31C514E), UINT64_C(0x8C036647E2186726) } },
+    { UINT64_C(0xFFFFFFFFFFFFFFFF), {
+        UINT64_C(0x52E1B3641CF5AFC4), UINT64_C(0xA559315837E78A09), UINT64_C(0x6835C9AC0180CC0F), UINT64_C(0x4C89EFA3F170A715),
+        UINT64_C(0x40731C89871C4C6C), UINT64_C(0xDF20C2E9EBAB8E7D), UINT64_C(0x1ABD6EE6ADC6E634), UINT64_C(0x22C713FC8107F2B8) } },
+};
+
+/* Digest of counter mode blocks, key initialized with seed 1 */
+static const counter_vector_t COUNTER_VECTORS[] = {
+    { UINT64_C(0x0000000000000000), UINT64_C(0x1279BB3D5DA5B294) },
+    { UINT64_C(0x0000000000000001), UINT64_C(0x34FF2D3FC8A540A5) },
+    { UINT64_C(0x0000000000000002), UINT64_C(0xB8E8E299328DD984) },
+    { UINT64_C(0x00000000000003E8), UINT64_C(0x80698AAC9E33181E) },
+    { UINT64_C(0x0000000100000007), UINT64_C(0x986A78E457A9C3EF) },
+    { UINT64_C(0xFFFFFFFFFFFFFFFF), UINT64_C(0x88276B5B297C0E26) },
+};
+
+#define ARRAY_SIZE(X) (sizeof(X) / sizeof((X)[0]))
+
+/* ======================================================================== */
+/* Utility functions                                                        */
+/* ======================================================================== */
+
+static size_t failures = 0U;
+
+#define CHECK(COND, ...) do { \
+    if (!(COND)) { \
+        printf("FAILED: " __VA_ARGS__); \
+        putchar('\n'); \
+        ++failures; \
+    } \
+} while(0)
+
+/* Same generator as used by xxHash's sanity checks */
+static void fill_sanity_buffer(uint8_t *const buffer, const size_t length)
+{
+    uint64_t value = UINT64_C(2654435761);
+    size_t pos;
+    for (pos = 0U; pos < length; ++pos) {
+        buffer[pos] = (uint8_t)(value >> 56);
+        value *= UINT64_C(11400714785074694797);
+    }
+}
+
+/* ======================================================================== */
+/* Scalar reference tests                                                   */
+/* ======================================================================== */
+
+static void test_xxh64(void)
+{
+    static const size_t CHUNKS[] = { 1U, 7U, 31U, 32U, 33U, 100U };
+    uint8_t buffer[256U];
+    xxh64prng_hash_t hash;
+    size_t index, chunk, pos;
+
+    fill_sanity_buffer(buffer, sizeof(buffer));
+
+    for (index = 0U; index < ARRAY_SIZE(XXH64_VECTORS); ++index) {
+        const xxh64_vector_t *const vector = &XXH64_VECTORS[index];
+        CHECK(XXH64(buffer, vector->length, vector->seed) == vector->digest, "XXH64(), length %u, seed %016llX", (unsigned)vector->length, (unsigned long long)vector->seed);
+        CHECK(xxh64prng_hash(buffer, vector->length, vector->seed) == vector->digest, "xxh64prng_hash(), length %u, seed %016llX", (unsigned)vector->length, (unsigned long long)vector->seed);
+        for (chunk = 0U; chunk < ARRAY_SIZE(CHUNKS); ++chunk) {
+            xxh64prng_hash_init(&hash, vector->seed);
+            for (pos = 0U; pos < vector->length; pos += CHUNKS[chunk]) {
+                const size_t remaining = vector->length - pos;
+                xxh64prng_hash_update(&hash, buffer + pos, (remaining < CHUNKS[chunk]) ? remaining : CHUNKS[chunk]);
+                CHECK(xxh64prng_hash_digest(&hash) == XXH64(buffer, pos + ((remaining < CHUNKS[chunk]) ? remaining : CHUNKS[chunk]), vector->seed), "xxh64prng_hash_digest(), length %u, chunk %u, position %u", (unsigned)vector->length, (unsigned)CHUNKS[chunk], (unsigned)pos);
+            }
+            CHECK(xxh64prng_hash_digest(&hash) == vector->digest, "xxh64prng_hash_update(), length %u, seed %016llX, chunk %u", (unsigned)vector->length, (unsigned long long)vector->seed, (unsigned)CHUNKS[chunk]);
+        }
+    }
+}
+
+static void test_init(void)
+{
+    xxh64prng_t state;
+    size_t index;
+
+    for (index = 0U; index < ARRAY_SIZE(INIT_VECTORS); ++index) {
+        xxh64prng_init(&state, INIT_VECTORS[index].seed);
+        CHECK(!memcmp(state.state, INIT_VECTORS[index].state, _XXH64PRNG_STATE_BYTES), "xxh64prng_init(), seed %016llX", (unsigned long long)INIT_VECTORS[index].seed);
+    }
+}
+
+static void test_next(const char *const impl)
+{
+    static uint64_t blocks[NEXT_BLOCKS][XXH64PRNG_OUTPUT_WORDS];
+    xxh64prng_t state;
+    size_t index, pos;
+
+    for (index = 0U; index < ARRAY_SIZE(NEXT_VECTORS); ++index) {
+        const next_vector_t *const vector = &NEXT_VECTORS[index];
+        xxh64prng_init(&state, vector->seed);
+        for (pos = 0U; pos < NEXT_BLOCKS; ++pos) {
+            xxh64prng_next(&state, blocks[pos]);
+        }
+        CHECK(XXH64(blocks, sizeof(blocks), 0U) == vector->digest, "xxh64prng_next() [%s], seed %016llX: output mismatch", impl, (unsigned long long)vector->seed);
+        CHECK(!memcmp(state.state, vector->state, _XXH64PRNG_STATE_BYTES), "xxh64prng_next() [%s], seed %016llX: state mismatch", impl, (unsigned long long)vector->seed);
+    }
+}
+
+static void test_retry(const char *const impl)
+{
+    uint64_t block[XXH64PRNG_OUTPUT_WORDS];
+    xxh64prng_t state;
+    size_t index;
+
+    for (index = 0U; index < ARRAY_SIZE(RETRY_VECTORS); ++index) {
+        const retry_vector_t *const vector = &RETRY_VECTORS[index];
+        xxh64prng_init(&state, vector->seed);
+        xxh64prng_test_force_retry = vector->retries;
+        xxh64prng_next(&state, block);
+        CHECK(xxh64prng_test_force_retry == 0U, "xxh64prng_next() [%s]: forced retries not consumed", impl);
+        CHECK(XXH64(block, sizeof(block), 0U) == vector->digest, "xxh64prng_next() [%s], seed %016llX, %u forced retries", impl, (unsigned long long)vector->seed, (unsigned)vector->retries);
+    }
+
+    xxh64prng_test_force_retry = 0U;
+}
+
+static void test_partial(const char *const impl)
+{
+    static const size_t COUNTS[] = { 0U, 1U, 3U, 4U, 5U, 8U, 9U, 95U, 96U };
+    static const size_t LENGTHS[] = { 0U, 1U, 31U, 32U, 33U, 767U, 768U, 769U, 2000U };
+    static uint8_t expected[4U * XXH64PRNG_OUTPUT_BYTES], actual[4U * XXH64PRNG_OUTPUT_BYTES];
+    uint64_t block[XXH64PRNG_OUTPUT_WORDS], partial[XXH64PRNG_OUTPUT_WORDS];
+    xxh64prng_t state, state_partial;
+    xxh64prng_stream_t stream;
+    xxh64prng_ctr_t ctr;
+    size_t index, offset, after;
+
+    for (index = 0U; index < ARRAY_SIZE(COUNTS); ++index) {
+        xxh64prng_init(&state, UINT64_C(42));
+        state_partial = state;
+        memset(partial, 0, sizeof(partial));
+        xxh64prng_next(&state, block);
+        xxh64prng_next_partial(&state_partial, partial, COUNTS[index]);
+        CHECK(!memcmp(block, partial, COUNTS[index] * sizeof(uint64_t)), "xxh64prng_next_partial() [%s], %u words: output mismatch", impl, (unsigned)COUNTS[index]);
+        CHECK((COUNTS[index] >= XXH64PRNG_OUTPUT_WORDS) || (partial[COUNTS[index]] == 0U), "xxh64prng_next_partial() [%s], %u words: overflow", impl, (unsigned)COUNTS[index]);
+        CHECK(!memcmp(&state, &state_partial, sizeof(xxh64prng_t)), "xxh64prng_next_partial() [%s], %u words: state mismatch", impl, (unsigned)COUNTS[index]);
+    }
+
+    /* the final fill must give the same bytes, and drop the remainder of the block */
+    xxh64prng_init(&state, UINT64_C(7));
+    for (offset = 0U; offset < 800U; offset += 100U) {
+        for (index = 0U; index < ARRAY_SIZE(LENGTHS); ++index) {
+            const size_t len = LENGTHS[index];
+            const size_t dropped = (XXH64PRNG_OUTPUT_BYTES - ((offset + len) % XXH64PRNG_OUTPUT_BYTES)) % XXH64PRNG_OUTPUT_BYTES;
+            xxh64prng_stream_init(&stream, &state);
+            xxh64prng_fill(&stream, expected, sizeof(expected));
+            xxh64prng_stream_init(&stream, &state);
+            xxh64prng_fill(&stream, actual, offset);
+            xxh64prng_fill_final(&stream, actual + offset, len);
+            after = offset + len + dropped;
+            xxh64prng_fill(&stream, actual + after, sizeof(actual) - after);
+            CHECK(!memcmp(expected, actual, offset + len) && !memcmp(expected + after, actual + after, sizeof(actual) - after), "xxh64prng_fill_final() [%s], offset %u, length %u", impl, (unsigned)offset, (unsigned)len);
+            xxh64prng_ctr_init(&ctr, &state);
+            xxh64prng_ctr_fill(&ctr, expected, sizeof(expected));
+            xxh64prng_ctr_init(&ctr, &state);
+            xxh64prng_ctr_fill(&ctr, actual, offset);
+            xxh64prng_ctr_fill_final(&ctr, actual + offset, len);
+            xxh64prng_ctr_fill(&ctr, actual + after, sizeof(actual) - after);
+            CHECK(!memcmp(expected, actual, offset + len) && !memcmp(expected + after, actual + after, sizeof(actual) - after), "xxh64prng_ctr_fill_final() [%s], offset %u, length %u", impl, (unsigned)offset, (unsigned)len);
+        }
+    }
+}
+
+static void test_discard(const char *const impl)
+{
+    static const uint64_t SKIPS[] = { 0U, 1U, 100U, 767U, 768U, 769U, 2000U, 5000U };
+    static uint8_t expected[8U * XXH64PRNG_OUTPUT_BYTES], actual[8U * XXH64PRNG_OUTPUT_BYTES];
+    uint64_t block[XXH64PRNG_OUTPUT_WORDS];
+    xxh64prng_t state, state_discard;
+    xxh64prng_stream_t stream;
+    size_t nblocks, index, offset;
+
+    for (nblocks = 0U; nblocks < 4U; ++nblocks) {
+        xxh64prng_init(&state, UINT64_C(42));
+        state_discard = state;
+        for (index = 0U; index < nblocks; ++index) {
+            xxh64prng_next(&state, block);
+        }
+        xxh64prng_discard(&state_discard, nblocks);
+        CHECK(!memcmp(&state, &state_discard, sizeof(xxh64prng_t)), "xxh64prng_discard() [%s], %u blocks", impl, (unsigned)nblocks);
+    }
+
+    /* the re-hash loop must be repeated exactly like in xxh64prng_next() */
+    for (index = 0U; index < ARRAY_SIZE(RETRY_VECTORS); ++index) {
+        const retry_vector_t *const vector = &RETRY_VECTORS[index];
+        xxh64prng_init(&state, vector->seed);
+        state_discard = state;
+        xxh64prng_test_force_retry = vector->retries;
+        xxh64prng_next(&state, block);
+        xxh64prng_test_force_retry = vector->retries;
+        xxh64prng_discard(&state_discard, 1U);
+        CHECK(xxh64prng_test_force_retry == 0U, "xxh64prng_discard() [%s]: forced retries not consumed", impl);
+        CHECK(!memcmp(&state, &state_discard, sizeof(xxh64prng_t)), "xxh64prng_discard() [%s], %u forced retries", impl, (unsigned)vector->retries);
+    }
+    xxh64prng_test_force_retry = 0U;
+
+    xxh64prng_init(&state, UINT64_C(7));
+    xxh64prng_stream_init(&stream, &state);
+    xxh64prng_fill(&stream, expected, sizeof(expected));
+    for (offset = 0U; offset < 800U; offset += 200U) {
+        for (index = 0U; index < ARRAY_SIZE(SKIPS); ++index) {
+            const size_t position = offset + (size_t)SKIPS[index];
+            xxh64prng_stream_init(&stream, &state);
+            xxh64prng_fill(&stream, actual, offset);
+            xxh64prng_skip(&stream, SKIPS[index]);
+            xxh64prng_fill(&stream, actual + position, sizeof(actual) - position);
+            CHECK(!memcmp(expected + position, actual + position, sizeof(actual) - position), "xxh64prng_skip() [%s], offset %u, %u bytes", impl, (unsigned)offset, (unsigned)SKIPS[index]);
+        }
+    }
+}
+
+static void test_checkpoint(void)
+{
+    static const uint64_t OFFSETS[] = { 0U, 1U, 767U, 768U, 769U, 2000U, 5000U };
+    static uint8_t expected[8U * XXH64PRNG_OUTPUT_BYTES], actual[8U * XXH64PRNG_OUTPUT_BYTES];
+    uint8_t data[XXH64PRNG_CHECKPOINT_BYTES];
+    xxh64prng_t state, restored;
+    xxh64prng_stream_t stream;
+    uint64_t offset = 0U, origin = 0U;
+    uint32_t flags = 0U;
+    size_t index;
+
+    xxh64prng_init(&state, UINT64_C(42));
+    xxh64prng_checkpoint_encode(data, &state, UINT64_C(0x123456789ABCDEF), UINT64_C(0x1000), XXH64PRNG_CHECKPOINT_COUNTER);
+    CHECK(xxh64prng_checkpoint_decode(data, &restored, &offset, &origin, &flags), "xxh64prng_checkpoint_decode()");
+    CHECK(!memcmp(&state, &restored, sizeof(xxh64prng_t)), "xxh64prng_checkpoint_decode(), state");
+    CHECK((offset == UINT64_C(0x123456789ABCDEF)) && (origin == UINT64_C(0x1000)) && (flags == XXH64PRNG_CHECKPOINT_COUNTER), "xxh64prng_checkpoint_decode(), offset/origin/flags");
+
+    /* every single-bit error must be detected */
+    for (index = 0U; index < 8U * XXH64PRNG_CHECKPOINT_BYTES; ++index) {
+        data[index / 8U] ^= (uint8_t)(1U << (index % 8U));
+        CHECK(!xxh64prng_checkpoint_decode(data, &restored, &offset, &origin, &flags), "xxh64prng_checkpoint_decode(), bit %u flipped", (unsigned)index);
+        data[index / 8U] ^= (uint8_t)(1U << (index % 8U));
+    }
+
+    /* the output can not start after the current position */
+    xxh64prng_checkpoint_encode(data, &state, UINT64_C(100), UINT64_C(101), 0U);
+    CHECK(!xxh64prng_checkpoint_decode(data, &restored, &offset, &origin, &flags), "xxh64prng_checkpoint_decode(), origin after offset");
+
+    /* a checkpoint holds the state of the block that contains the offset */
+    xxh64prng_init(&state, UINT64_C(7));
+    xxh64prng_stream_init(&stream, &state);
+    xxh64prng_fill(&stream, expected, sizeof(expected));
+    for (index = 0U; index < ARRAY_SIZE(OFFSETS); ++index) {
+        const size_t position = (size_t)OFFSETS[index];
+        restored = state;
+        xxh64prng_discard(&restored, position / XXH64PRNG_OUTPUT_BYTES);
+        xxh64prng_checkpoint_encode(data, &restored, position, 0U, 0U);
+        CHECK(xxh64prng_checkpoint_decode(data, &restored, &offset, &origin, &flags) && (offset == position) && (!origin) && (!flags), "xxh64prng_checkpoint_decode(), offset %u", (unsigned)position);
+        xxh64prng_stream_resume(&stream, &restored, offset);
+        xxh64prng_fill(&stream, actual + position, sizeof(actual) - position);
+        CHECK(!memcmp(expected + position, actual + position, sizeof(actual) - position), "xxh64prng_stream_resume(), offset %u", (unsigned)position);
+    }
+
+    xxh64prng_zero(data, sizeof(data));
+}
+
+static void test_stats(void)
+{
+    uint64_t blocks[4U * XXH64PRNG_OUTPUT_WORDS];
+    xxh64prng_stats_t stats, snapshot;
+    xxh64prng_t state, lanes[4U];
+    xxh64prng_x4_t x4;
+    xxh64prng_ctr_t ctr;
+    size_t index;
+
+    memset(&stats, 0, sizeof(stats));
+    xxh64prng_set_stats(&stats);
+    xxh64prng_init(&state, UINT64_C(42));
+    xxh64prng_next(&state, blocks);
+    xxh64prng_test_force_retry = 1U;
+    xxh64prng_next_partial(&state, blocks, 5U);
+    xxh64prng_test_force_retry = 0U;
+    xxh64prng_discard(&state, 3U);
+    xxh64prng_ctr_init(&ctr, &state);
+    xxh64prng_ctr_block(&ctr, 7U, blocks);
+    for (index = 0U; index < 4U; ++index) {
+        xxh64prng_derive(&lanes[index], &state, (uint64_t)index);
+    }
+    xxh64prng_x4_load(&x4, lanes);
+    xxh64prng_next_x4(&x4, blocks);
+
+    CHECK(xxh64prng_get_stats(&snapshot) && (!memcmp(&snapshot, &stats, sizeof(stats))), "xxh64prng_get_stats()");
+    CHECK((stats.blocks == 7U) && (stats.steps == 18U) && (stats.retries == 1U), "xxh64prng_set_stats(), counted %u blocks, %u steps, %u retries", (unsigned)stats.blocks, (unsigned)stats.steps, (unsigned)stats.retries);
+
+    xxh64prng_set_stats(NULL);
+    xxh64prng_next(&state, blocks);
+    CHECK((!xxh64prng_get_stats(&snapshot)) && (stats.blocks == 7U), "xxh64prng_set_stats(), disabled");
+}
+
+static void test_pool(void)
+{
+    static const size_t SIZES[] = { 1U, 8U, 767U, 3000U, 4U, 5U * XXH64PRNG_OUTPUT_BYTES + 5U, 768U, 100U };
+    static uint8_t expected[3U][16U * XXH64PRNG_OUTPUT_BYTES], actual[3U][16U * XXH64PRNG_OUTPUT_BYTES];
+    xxh64prng_local_t *local[3U];
+    xxh64prng_pool_t *pool;
+    xxh64prng_stream_t stream;
+    xxh64prng_t master, state;
+    size_t position, refiller, index, round;
+
+    xxh64prng_init(&master, UINT64_C(42));
+    for (index = 0U; index < 3U; ++index) {
+        xxh64prng_derive(&state, &master, (uint64_t)index);
+        xxh64prng_stream_init(&stream, &state);
+        xxh64prng_fill(&stream, expected[index], sizeof(expected[index]));
+    }
+
+    for (refiller = 0U; refiller < 2U; ++refiller) {
+        CHECK((pool = xxh64prng_pool_create(&master, 3U, 4U, refiller != 0U)) != NULL, "xxh64prng_pool_create(), refiller %u", (unsigned)refiller);
+        if (!pool) {
+            continue;
+        }
+        for (index = 0U; index < 3U; ++index) {
+            CHECK((local[index] = xxh64prng_pool_acquire(pool)) != NULL, "xxh64prng_pool_acquire(), slot %u", (unsigned)index);
+        }
+        CHECK(xxh64prng_pool_acquire(pool) == NULL, "xxh64prng_pool_acquire(), all slots in use");
+        memset(actual, 0, sizeof(actual));
+
+        /* generator N yields the stream derived with ID N, across all owners */
+        for (position = 0U, round = 0U; round < ARRAY_SIZE(SIZES); position += SIZES[round++]) {
+            for (index = 0U; index < 3U; ++index) {
+                if (!local[index]) {
+                    continue;
+                }
+                if (SIZES[round] == sizeof(uint64_t)) {
+                    const uint64_t value = xxh64prng_local_next_u64(local[index]);
+                    memcpy(actual[index] + position, &value, sizeof(uint64_t));
+                }
+                else if (SIZES[round] == sizeof(uint32_t)) {
+                    const uint32_t value = xxh64prng_local_next_u32(local[index]);
+                    memcpy(actual[index] + position, &value, sizeof(uint32_t));
+                }
+                else {
+                    xxh64prng_local_fill(local[index], actual[index] + position, SIZES[round]);
+                }
+            }
+            if (round == 3U) {
+                xxh64prng_pool_release(local[1U]);
+                CHECK(xxh64prng_pool_acquire(pool) == local[1U], "xxh64prng_pool_acquire(), released slot");
+            }
+        }
+
+        for (index = 0U; index < 3U; ++index) {
+            CHECK(!memcmp(expected[index], actual[index], position), "xxh64prng_local_fill(), slot %u, refiller %u", (unsigned)index, (unsigned)refiller);
+            xxh64prng_pool_release(local[index]);
+        }
+        xxh64prng_pool_destroy(pool);
+    }
+}
+
+/* Rough statistical checks, the values are deterministic (fixed seed), so the bounds are about ten standard deviations wide */
+static void test_distributions(void)
+{
+    static double values[DIST_VALUES];
+    static float values_f[DIST_VALUES];
+    xxh64prng_t state;
+    xxh64prng_stream_t stream;
+    double sum, sum_sq, mean, variance, min_value, max_value;
+    size_t pos, tail, far_tail;
+    float max_value_f;
+
+    xxh64prng_init(&state, UINT64_C(99));
+    xxh64prng_stream_init(&stream, &state);
+
+    /* uniform: range [0, 1), mean 1/2, variance 1/12 */
+    xxh64prng_fill_uniform(&stream, values, DIST_VALUES);
+    sum = sum_sq = 0.0;
+    min_value = 1.0;
+    max_value = 0.0;
+    for (pos = 0U; pos < DIST_VALUES; ++pos) {
+        sum += values[pos];
+        sum_sq += values[pos] * values[pos];
+        min_value = (values[pos] < min_value) ? values[pos] : min_value;
+        max_value = (values[pos] > max_value) ? values[pos] : max_value;
+    }
+    mean = sum / DIST_VALUES;
+    variance = (sum_sq / DIST_VALUES) - (mean * mean);
+    CHECK((min_value >= 0.0) && (max_value < 1.0), "fill_uniform(), range [%g, %g]", min_value, max_value);
+    CHECK((mean > 0.497) && (mean < 0.503), "fill_uniform(), mean %g", mean);
+    CHECK((variance > (1.0 / 12.0) - 0.002) && (variance < (1.0 / 12.0) + 0.002), "fill_uniform(), variance %g", variance);
+
+    /* uniform_f: range [0, 1), must never be rounded up to 1.0f */
+    xxh64prng_fill_uniform_f(&stream, values_f, DIST_VALUES);
+    sum = 0.0;
+    max_value_f = 0.0f;
+    for (pos = 0U; pos < DIST_VALUES; ++pos) {
+        CHECK((values_f[pos] >= 0.0f) && (values_f[pos] < 1.0f), "fill_uniform_f(), value %g out of range", (double)values_f[pos]);
+        sum += values_f[pos];
+        max_value_f = (values_f[pos] > max_value_f) ? values_f[pos] : max_value_f;
+    }
+    mean = sum / DIST_VALUES;
+    CHECK((mean > 0.497) && (mean < 0.503), "fill_uniform_f(), mean %g", mean);
+    CHECK(max_value_f > 0.999f, "fill_uniform_f(), maximum %g", (double)max_value_f);
+
+    /* normal: mean 0, variance 1, P(|x| > 3) = 0.0027, P(|x| > 3.65) = 0.00026 (the tail beyond the ziggurat) */
+    xxh64prng_fill_normal(&stream, values, DIST_VALUES);
+    sum = sum_sq = 0.0;
+    tail = far_tail = 0U;
+    for (pos = 0U; pos < DIST_VALUES; ++pos) {
+        sum += values[pos];
+        sum_sq += values[pos] * values[pos];
+        tail += (fabs(values[pos]) > 3.0) ? 1U : 0U;
+        far_tail += (fabs(values[pos]) > 3.65) ? 1U : 0U;
+    }
+    mean = sum / DIST_VALUES;
+    variance = (sum_sq / DIST_VALUES) - (mean * mean);
+    CHECK((mean > -0.01) && (mean < 0.01), "fill_normal(), mean %g", mean);
+    CHECK((variance > 0.98) && (variance < 1.02), "fill_normal(), variance %g", variance);
+    CHECK((tail > 2200U) && (tail < 3200U), "fill_normal(), %u values beyond 3", (unsigned)tail);
+    CHECK((far_tail > 160U) && (far_tail < 360U), "fill_normal(), %u values beyond 3.65", (unsigned)far_tail);
+
+    /* exponential: non-negative, mean 1, variance 1, P(x > 5) = 0.0067, P(x > 7.7) = 0.00045 (the tail beyond the ziggurat) */
+    xxh64prng_fill_exponential(&stream, values, DIST_VALUES);
+    sum = sum_sq = 0.0;
+    min_value = 1.0;
+    tail = far_tail = 0U;
+    for (pos = 0U; pos < DIST_VALUES; ++pos) {
+        sum += values[pos];
+        sum_sq += values[pos] * values[pos];
+        min_value = (values[pos] < min_value) ? values[pos] : min_value;
+        tail += (values[pos] > 5.0) ? 1U : 0U;
+        far_tail += (values[pos] > 7.7) ? 1U : 0U;
+    }
+    mean = sum / DIST_VALUES;
+    variance = (sum_sq / DIST_VALUES) - (mean * mean);
+    CHECK(min_value >= 0.0, "fill_exponential(), minimum %g", min_value);
+    CHECK((mean > 0.99) && (mean < 1.01), "fill_exponential(), mean %g", mean);
+    CHECK((variance > 0.95) && (variance < 1.05), "fill_exponential(), variance %g", variance);
+    CHECK((tail > 5900U) && (tail < 7600U), "fill_exponential(), %u values beyond 5", (unsigned)tail);
+    CHECK((far_tail > 300U) && (far_tail < 620U), "fill_exponential(), %u values beyond 7.7", (unsigned)far_tail);
+}
+
+/* Generate one block for each of "lanes" states, using the interleaved functions */
+static void next_lanes(xxh64prng_t *const states, uint64_t *const out, const size_t lanes)
+{
+    xxh64prng_x4_t x4;
+    xxh64prng_x8_t x8;
+
+    if (lanes == 4U) {
+        xxh64prng_x4_load(&x4, states);
+        xxh64prng_next_x4(&x4, out);
+        xxh64prng_x4_store(&x4, states);
+    }
+    else {
+        xxh64prng_x8_load(&x8, states);
+        xxh64prng_next_x8(&x8, out);
+        xxh64prng_x8_store(&x8, states);
+    }
+}
+
+static void test_interleaved(const char *const impl)
+{
+    static uint64_t blocks[NEXT_BLOCKS][8U][XXH64PRNG_OUTPUT_WORDS];
+    static const size_t LANES[] = { 4U, 8U };
+    uint64_t lane_blocks[NEXT_BLOCKS][XXH64PRNG_OUTPUT_WORDS], expected[XXH64PRNG_OUTPUT_WORDS];
+    xxh64prng_t states[8U];
+    size_t index, lanes, lane, pos;
+
+    for (index = 0U; index < ARRAY_SIZE(LANES); ++index) {
+        lanes = LANES[index];
+        for (lane = 0U; lane < lanes; ++lane) {
+            xxh64prng_init(&states[lane], NEXT_VECTORS[lane % ARRAY_SIZE(NEXT_VECTORS)].seed);
+        }
+        for (pos = 0U; pos < NEXT_BLOCKS; ++pos) {
+            next_lanes(states, &blocks[pos][0U][0U], lanes);
+        }
+        for (lane = 0U; lane < lanes; ++lane) {
+            const next_vector_t *const vector = &NEXT_VECTORS[lane % ARRAY_SIZE(NEXT_VECTORS)];
+            for (pos = 0U; pos < NEXT_BLOCKS; ++pos) {
+                memcpy(lane_blocks[pos], blocks[pos][lane], XXH64PRNG_OUTPUT_BYTES);
+            }
+            CHECK(XXH64(lane_blocks, sizeof(lane_blocks), 0U) == vector->digest, "xxh64prng_next_x%u() [%s], lane %u: output mismatch", (unsigned)lanes, impl, (unsigned)lane);
+            CHECK(!memcmp(states[lane].state, vector->state, _XXH64PRNG_STATE_BYTES), "xxh64prng_next_x%u() [%s], lane %u: state mismatch", (unsigned)lanes, impl, (unsigned)lane);
+        }
+
+        /* the forced retries are consumed by the first lane, the other lanes must not be affected */
+        for (pos = 0U; pos < ARRAY_SIZE(RETRY_VECTORS); ++pos) {
+            const retry_vector_t *const vector = &RETRY_VECTORS[pos];
+            xxh64prng_init(&states[0U], vector->seed);
+            for (lane = 1U; lane < lanes; ++lane) {
+                xxh64prng_init(&states[lane], UINT64_C(0));
+            }
+            xxh64prng_test_force_retry = vector->retries;
+            next_lanes(states, &blocks[0U][0U][0U], lanes);
+            CHECK(xxh64prng_test_force_retry == 0U, "xxh64prng_next_x%u() [%s]: forced retries not consumed", (unsigned)lanes, impl);
+            CHECK(XXH64(blocks[0U][0U], XXH64PRNG_OUTPUT_BYTES, 0U) == vector->digest, "xxh64prng_next_x%u() [%s], %u forced retries", (unsigned)lanes, impl, (unsigned)vector->retries);
+            xxh64prng_init(&states[0U], UINT64_C(0));
+            xxh64prng_next(&states[0U], expected);
+            for (lane = 1U; lane < lanes; ++lane) {
+                CHECK(!memcmp(blocks[0U][lane], expected, XXH64PRNG_OUTPUT_BYTES), "xxh64prng_next_x%u() [%s], lane %u next to forced retries", (unsigned)lanes, impl, (unsigned)lane);
+            }
+        }
+        xxh64prng_test_force_retry = 0U;
+    }
+}
+
+static void test_derive(const char *const impl)
+{
+    xxh64prng_t parent, child;
+    size_t index;
+
+    xxh64prng_init(&parent, UINT64_C(42));
+
+    for (index = 0U; index < ARRAY_SIZE(DERIVE_VECTORS); ++index) {
+        xxh64prng_derive(&child, &parent, DERIVE_VECTORS[index].id);
+        CHECK(!memcmp(child.state, DERIVE_VECTORS[index].state, _XXH64PRNG_STATE_BYTES), "xxh64prng_derive() [%s], id %016llX", impl, (unsigned long long)DERIVE_VECTORS[index].id);
+    }
+}
+
+static void test_counter(const char *const impl)
+{
+    uint64_t block[XXH64PRNG_OUTPUT_WORDS];
+    xxh64prng_t state;
+    xxh64prng_ctr_t ctr;
+    size_t index;
+
+    xxh64prng_init(&state, UINT64_C(1));
+    xxh64prng_ctr_init(&ctr, &state);
+
+    for (index = 0U; index < ARRAY_SIZE(COUNTER_VECTORS); ++index) {
+        xxh64prng_ctr_block(&ctr, COUNTER_VECTORS[index].index, block);
+        CHECK(XXH64(block, sizeof(block), 0U) == COUNTER_VECTORS[index].digest, "xxh64prng_ctr_block() [%s], index %016llX", impl, (unsigned long long)COUNTER_VECTORS[index].index);
+    }
+}
+
+/* ======================================================================== */
+/* Entropy seeding                                                          */
+/* ======================================================================== */
+
+#define SEED_STATES 300U
+
+static void test_seed(void)
+{
+    static xxh64prng_t states[SEED_STATES];
+    static const uint8_t zero[sizeof(xxh64prng_t)];
+    size_t index, other;
+
+    /* the first batch is too large for the pool, the others are served from it */
+    CHECK(xxh64prng_seed_batch(states, 200U), "xxh64prng_seed_batch(), 200 states");
+    CHECK(xxh64prng_seed_batch(states + 200U, 99U), "xxh64prng_seed_batch(), 99 states");
+    CHECK(xxh64prng_seed(states + 299U), "xxh64prng_seed()");
+    CHECK(xxh64prng_seed_batch(states, 0U), "xxh64prng_seed_batch(), 0 states");
+
+    for (index = 0U; index < SEED_STATES; ++index) {
+        CHECK(memcmp(&states[index], zero, sizeof(xxh64prng_t)), "xxh64prng_seed_batch(), state %u is zero", (unsigned)index);
+        for (other = 0U; other < index; ++other) {
+            CHECK(memcmp(&states[index], &states[other], sizeof(xxh64prng_t)), "xxh64prng_seed_batch(), states %u and %u are equal", (unsigned)other, (unsigned)index);
+        }
+    }
+
+#ifndef _WIN32
+    {
+        /* after fork(), the child must *not* receive the same bytes from the pool as the parent */
+        xxh64prng_t parent, child;
+        int fds[2U], status = 0;
+        pid_t pid;
+
+        CHECK(pipe(fds) == 0, "pipe()");
+        CHECK((pid = fork()) >= 0, "fork()");
+        if (pid == 0) {
+            const bool succeeded = xxh64prng_seed(&child);
+            _exit((succeeded && (write(fds[1U], &child, sizeof(child)) == (ssize_t)sizeof(child))) ? 0 : 1);
+        }
+        close(fds[1U]);
+        CHECK(xxh64prng_seed(&parent), "xxh64prng_seed(), parent");
+        CHECK(read(fds[0U], &child, sizeof(child)) == (ssize_t)sizeof(child), "xxh64prng_seed(), child");
+        CHECK((waitpid(pid, &status, 0) == pid) && WIFEXITED(status) && (WEXITSTATUS(status) == 0), "xxh64prng_seed(), child status");
+        close(fds[0U]);
+        CHECK(memcmp(&parent, &child, sizeof(xxh64prng_t)), "xxh64prng_seed(), entropy pool shared across fork()");
+    }
+#endif
+}
+
+/* ======================================================================== */
+/* Cross-checks against the scalar reference                                */
+/* ======================================================================== */
+
+typedef struct reference {
+    uint8_t chain[CROSS_BYTES];
+    uint8_t counter[CROSS_BYTES];
+    xxh64prng_t children[100U];
+    double uniform[CROSS_VALUES];
+    float uniform_f[CROSS_VALUES];
+    double normal[CROSS_VALUES];
+    double exponential[CROSS_VALUES];
+} reference_t;
+
+static void compute_reference(reference_t *const ref, xxh64prng_mt_t *const mt)
+{
+    xxh64prng_t state;
+    xxh64prng_stream_t stream;
+    xxh64prng_ctr_t ctr;
+
+    xxh64prng_init(&state, UINT64_C(7));
+
+    xxh64prng_stream_init(&stream, &state);
+    if (mt) {
+        xxh64prng_mt_fill(mt, &stream, ref->chain, CROSS_BYTES);
+    }
+    else {
+        xxh64prng_fill(&stream, ref->chain, CROSS_BYTES);
+    }
+
+    xxh64prng_ctr_init(&ctr, &state);
+    xxh64prng_ctr_seek(&ctr, UINT64_C(1) << 40);
+    if (mt) {
+        xxh64prng_mt_ctr_fill(mt, &ctr, ref->counter, CROSS_BYTES);
+    }
+    else {
+        xxh64prng_ctr_fill(&ctr, ref->counter, CROSS_BYTES);
+    }
+
+    xxh64prng_derive_batch(ref->children, ARRAY_SIZE(ref->children), &state, UINT64_C(5));
+
+    xxh64prng_stream_init(&stream, &state);
+    xxh64prng_fill_uniform(&stream, ref->uniform, CROSS_VALUES);
+    xxh64prng_fill_uniform_f(&stream, ref->uniform_f, CROSS_VALUES);
+    xxh64prng_fill_normal(&stream, ref->normal, CROSS_VALUES);
+    xxh64prng_fill_exponential(&stream, ref->exponential, CROSS_VALUES);
+}
+
+static void test_multistate(const char *const impl, const xxh64_multistate_t kernel)
+{
+    uint64_t input[_XXH64PRNG_STATE_WORDS * 8U], message[_XXH64PRNG_STATE_WORDS], seed[13U * 8U], out[13U * 8U];
+    size_t lanes, count, pos, lane, word;
+
+    fill_sanity_buffer((uint8_t*)input, sizeof(input));
+    fill_sanity_buffer((uint8_t*)seed, sizeof(seed));
+
+    for (lanes = 4U; lanes <= 8U; lanes += 4U) {
+        for (count = 0U; count <= 13U; ++count) {
+            kernel(input, seed, out, lanes, count);
+            for (pos = 0U; pos < count; ++pos) {
+                for (lane = 0U; lane < lanes; ++lane) {
+                    for (word = 0U; word < _XXH64PRNG_STATE_WORDS; ++word) {
+                        message[word] = input[(word * lanes) + lane];
+                    }
+                    CHECK(out[(pos * lanes) + lane] == XXH64(message, sizeof(message), seed[(pos * lanes) + lane]), "multi-state kernel [%s], %u lanes, count %u, row %u, lane %u", impl, (unsigned)lanes, (unsigned)count, (unsigned)pos, (unsigned)lane);
+                }
+            }
+        }
+    }
+}
+
+static void test_multiseed(const char *const impl, const xxh64_multiseed_t kernel)
+{
+    uint64_t input[_XXH64PRNG_STATE_WORDS], seed[41U], out[42U];
+    size_t count, pos;
+
+    fill_sanity_buffer((uint8_t*)input, sizeof(input));
+    fill_sanity_buffer((uint8_t*)seed, sizeof(seed));
+
+    for (count = 0U; count <= ARRAY_SIZE(seed); ++count) {
+        uint8_t *const unaligned = ((uint8_t*)out) + 3U;
+        kernel(input, seed, unaligned, count);
+        for (pos = 0U; pos < count; ++pos) {
+            uint64_t value;
+            memcpy(&value, unaligned + (pos * sizeof(uint64_t)), sizeof(uint64_t));
+            CHECK(value == XXH64(input, sizeof(input), seed[pos]), "multi-seed kernel [%s], count %u, lane %u", impl, (unsigned)count, (unsigned)pos);
+        }
+    }
+}
+
+static void test_hash_multi(const char *const impl)
+{
+    static uint8_t buffer[8192U];
+    const void *inputs[21U];
+    size_t lens[21U];
+    uint64_t out[21U];
+    size_t variant, count, pos;
+
+    fill_sanity_buffer(buffer, sizeof(buffer));
+
+    for (variant = 0U; variant < 4U; ++variant) {
+        for (pos = 0U; pos < ARRAY_SIZE(inputs); ++pos) {
+            inputs[pos] = buffer + ((pos * 331U) % 127U);
+            switch (variant) {
+            case 0U:
+                lens[pos] = 1000U; /* equal lengths */
+                break;
+            case 1U:
+                lens[pos] = 64U + ((pos * 977U) % 4096U);
+                break;
+            case 2U:
+                lens[pos] = (pos * 13U) % 100U; /* some are shorter than a stripe */
+                break;
+            default:
+                lens[pos] = 32U + (pos % 32U); /* exactly one stripe */
+            }
+        }
+        for (count = 0U; count <= ARRAY_SIZE(inputs); ++count) {
+            xxh64prng_hash_multi(inputs, lens, count, UINT64_C(0x9E3779B185EBCA8D), out);
+            for (pos = 0U; pos < count; ++pos) {
+                CHECK(out[pos] == XXH64(inputs[pos], lens[pos], UINT64_C(0x9E3779B185EBCA8D)), "xxh64prng_hash_multi() [%s], variant %u, count %u, buffer %u", impl, (unsigned)variant, (unsigned)count, (unsigned)pos);
+            }
+        }
+    }
+}
+
+static void test_cross(const char *const impl, const reference_t *const expected, reference_t *const actual, xxh64prng_mt_t *const mt)
+{
+    static const size_t CHUNKS[] = { 1U, 7U, 767U, 768U, 769U, 4096U, 10000U };
+    xxh64prng_t state;
+    xxh64prng_stream_t stream;
+    size_t offset = 0U, index = 0U;
+
+    memset(actual, 0, sizeof(reference_t));
+    compute_reference(actual, mt);
+
+    CHECK(!memcmp(expected->chain, actual->chain, CROSS_BYTES), "%sfill() [%s]", mt ? "mt_" : "", impl);
+    CHECK(!memcmp(expected->counter, actual->counter, CROSS_BYTES), "%sctr_fill() [%s]", mt ? "mt_" : "", impl);
+    CHECK(!memcmp(expected->children, actual->children, sizeof(actual->children)), "derive_batch() [%s]", impl);
+    CHECK(!memcmp(expected->uniform, actual->uniform, sizeof(actual->uniform)), "fill_uniform() [%s]", impl);
+    CHECK(!memcmp(expected->uniform_f, actual->uniform_f, sizeof(actual->uniform_f)), "fill_uniform_f() [%s]", impl);
+    CHECK(!memcmp(expected->normal, actual->normal, sizeof(actual->normal)), "fill_normal() [%s]", impl);
+    CHECK(!memcmp(expected->exponential, actual->exponential, sizeof(actual->exponential)), "fill_exponential() [%s]", impl);
+
+    /* odd, unaligned chunks must give the same sequence */
+    xxh64prng_init(&state, UINT64_C(7));
+    xxh64prng_stream_init(&stream, &state);
+    memset(actual->chain, 0, CROSS_BYTES);
+    while (offset < CROSS_BYTES - 1U) {
+        const size_t chunk = ((CROSS_BYTES - 1U - offset) < CHUNKS[index]) ? (CROSS_BYTES - 1U - offset) : CHUNKS[index];
+        xxh64prng_fill(&stream, actual->chain + 1U + offset, chunk);
+        offset += chunk;
+        index = (index + 1U) % ARRAY_SIZE(CHUNKS);
+    }
+    CHECK(!memcmp(expected->chain, actual->chain + 1U, CROSS_BYTES - 1U), "fill() [%s], unaligned chunks", impl);
+}
+
+/* ======================================================================== */
+/* MAIN                                                                     */
+/* ======================================================================== */
+
+int main(void)
+{
+    static reference_t expected, actual;
+    static const size_t THREADS[] = { 2U, 3U };
+    xxh64prng_impl_t impl;
+    xxh64prng_wipe_t policy;
+    size_t index, tested = 0U;
+
+    test_xxh64();
+    test_init();
+    test_seed();
+    test_checkpoint();
+    test_stats();
+    test_pool();
+    test_distributions();
+
+    CHECK(xxh64prng_get_wipe() == XXH64PRNG_WIPE_PARANOID, "xxh64prng_get_wipe(), default must be paranoid");
+
+    if (!xxh64prng_set_impl(XXH64PRNG_IMPL_SCALAR)) {
+        puts("FAILED: scalar implementation not available");
+        return EXIT_FAILURE;
+    }
+
+    compute_reference(&expected, NULL);
+
+    for (impl = XXH64PRNG_IMPL_SCALAR; xxh64prng_impl_name(impl) != NULL; ++impl) {
+        const char *const name = xxh64prng_impl_name(impl);
+        if (!xxh64prng_set_impl(impl)) {
+            printf("Skipped: %s (not supported)\n", name);
+            continue;
+        }
+        test_multiseed(name, XXH64_multiseed_kernel(impl));
+        test_multistate(name, XXH64_multistate_kernel(impl));
+        test_hash_multi(name);
+        test_next(name);
+        test_retry(name);
+        test_partial(name);
+        test_discard(name);
+        test_interleaved(name);
+        test_derive(name);
+        test_counter(name);
+        test_cross(name, &expected, &actual, NULL);
+        for (index = 0U; index < ARRAY_SIZE(THREADS); ++index) {
+            xxh64prng_mt_t *const mt = xxh64prng_mt_create(THREADS[index]);
+            CHECK(mt != NULL, "mt_create(%u)", (unsigned)THREADS[index]);
+            if (mt) {
+                test_cross(name, &expected, &actual, mt);
+                xxh64prng_mt_destroy(mt);
+            }
+        }
+        printf("Tested: %s\n", name);
+        ++tested;
+    }
+
+    /* the wiping policy must not have any effect on the output */
+    xxh64prng_set_impl(XXH64PRNG_IMPL_AUTO);
+    for (policy = XXH64PRNG_WIPE_ON_DESTROY; xxh64prng_wipe_name(policy) != NULL; ++policy) {
+        const char *const name = xxh64prng_wipe_name(policy);
+        CHECK(xxh64prng_set_wipe(policy), "xxh64prng_set_wipe(%s)", name);
+        test_next(name);
+        test_retry(name);
+        test_discard(name);
+        test_interleaved(name);
+        test_counter(name);
+        test_cross(name, &expected, &actual, NULL);
+        printf("Tested: wipe=%s\n", name);
+    }
+    xxh64prng_wipe_scratch();
+    xxh64prng_set_wipe(XXH64PRNG_WIPE_PARANOID);
+
+    if (failures) {
+        printf("\n%u check(s) have FAILED !!!\n", (unsigned)failures);
+        return EXIT_FAILURE;
+    }
+
+    printf("\nAll tests passed (%u implementations).\n", (unsigned)tested);
+    return EXIT_SUCCESS;
+}
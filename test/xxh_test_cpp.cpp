@@ -0,0 +1,184 @@
+/*
+ * XXH64-PRNG
+ * Blazing fast XXH64-based secure pseudo-random number generator
+ *
+ * Copyright (c) 2025 "dEajL3kA" <Cumpoing79@web.de>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * https://www.opensource.org/licenses/bsd-license.php
+ */
+
+#include <xxh64_prng.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <random>
+#include <sstream>
+#include <utility>
+#include <vector>
+
+/* ======================================================================== */
+/* Utility functions                                                        */
+/* ======================================================================== */
+
+static size_t failures = 0U;
+
+#define CHECK(COND, ...) do { \
+    if (!(COND)) { \
+        std::printf("FAILED: " __VA_ARGS__); \
+        std::putchar('\n'); \
+        ++failures; \
+    } \
+} while(0)
+
+#define TEST_VALUES 5000U
+
+/* Reference values from the C API */
+static std::vector<uint64_t> reference_u64(const uint64_t seed)
+{
+    std::vector<uint64_t> values(TEST_VALUES);
+    xxh64prng_t state;
+    xxh64prng_stream_t stream;
+    xxh64prng_init(&state, seed);
+    xxh64prng_stream_init(&stream, &state);
+    for (size_t pos = 0U; pos < TEST_VALUES; ++pos) {
+        values[pos] = xxh64prng_next_u64(&stream);
+    }
+    return values;
+}
+
+static std::vector<uint32_t> reference_u32(const uint64_t seed)
+{
+    std::vector<uint32_t> values(TEST_VALUES);
+    xxh64prng_t state;
+    xxh64prng_stream_t stream;
+    xxh64prng_init(&state, seed);
+    xxh64prng_stream_init(&stream, &state);
+    for (size_t pos = 0U; pos < TEST_VALUES; ++pos) {
+        values[pos] = xxh64prng_next_u32(&stream);
+    }
+    return values;
+}
+
+/* ======================================================================== */
+/* Engine tests                                                             */
+/* ======================================================================== */
+
+template<typename Engine, typename Value>
+static void test_sequence(const char *const name, const std::vector<Value> &expected)
+{
+    static const unsigned long long DISCARD[] = { 0U, 1U, 95U, 96U, 97U, 191U, 192U, 1000U, 4000U };
+    Engine engine(42U);
+    size_t pos;
+
+    for (pos = 0U; pos < expected.size(); ++pos) {
+        if (engine() != expected[pos]) {
+            break;
+        }
+    }
+    CHECK(pos == expected.size(), "%s: sequence mismatch at index %u", name, (unsigned)pos);
+
+    for (size_t index = 0U; index < sizeof(DISCARD) / sizeof(DISCARD[0]); ++index) {
+        Engine first(42U), second(42U);
+        first();
+        first.discard(DISCARD[index]);
+        for (unsigned long long count = 0U; count <= DISCARD[index]; ++count) {
+            second();
+        }
+        CHECK(first == second, "%s: discard(%llu), engines not equal", name, DISCARD[index]);
+        CHECK(first() == expected[DISCARD[index] + 1U], "%s: discard(%llu)", name, DISCARD[index]);
+    }
+
+    {
+        Engine original(42U), restored;
+        std::stringstream buffer;
+        original.discard(777U);
+        buffer << original;
+        buffer >> restored;
+        CHECK((!buffer.fail()) && (restored == original), "%s: serialization", name);
+        CHECK((restored() == expected[777U]) && (restored() == expected[778U]), "%s: serialization, sequence mismatch", name);
+    }
+
+    {
+        Engine original(42U);
+        original();
+        Engine moved(std::move(original));
+        CHECK(moved() == expected[1U], "%s: move construction", name);
+        Engine copy = moved.clone();
+        CHECK((copy == moved) && (copy() == expected[2U]), "%s: clone()", name);
+        original = std::move(copy);
+        CHECK(original() == expected[3U], "%s: move assignment", name);
+    }
+}
+
+static void test_std(void)
+{
+    std::seed_seq seq_a = { 1, 2, 3 }, seq_b = { 1, 2, 3 };
+    xxh64_prng::engine64 first(seq_a), second(seq_b), third(7U);
+    CHECK(first == second, "seed_seq: engines not equal");
+    CHECK(first != third, "seed_seq: engines equal");
+
+    std::uniform_int_distribution<int> dist(1, 6);
+    int histogram[7U] = { 0 };
+    for (size_t pos = 0U; pos < 60000U; ++pos) {
+        ++histogram[dist(first)];
+    }
+    for (size_t pos = 1U; pos <= 6U; ++pos) {
+        CHECK((histogram[pos] > 9000) && (histogram[pos] < 11000), "uniform_int_distribution: value %u occurs %d times", (unsigned)pos, histogram[pos]);
+    }
+
+    std::vector<int> values(100U);
+    for (size_t pos = 0U; pos < values.size(); ++pos) {
+        values[pos] = (int)pos;
+    }
+    std::shuffle(values.begin(), values.end(), second);
+    std::sort(values.begin(), values.end());
+    CHECK((values.front() == 0) && (values.back() == 99) && (std::unique(values.begin(), values.end()) == values.end()), "shuffle");
+
+    xxh64_prng::engine32 entropy_a = xxh64_prng::engine32::from_entropy(), entropy_b = xxh64_prng::engine32::from_entropy();
+    CHECK(entropy_a != entropy_b, "from_entropy(): engines equal");
+}
+
+/* ======================================================================== */
+/* MAIN                                                                     */
+/* ======================================================================== */
+
+int main(void)
+{
+    const std::vector<uint64_t> expected_u64 = reference_u64(42U);
+    const std::vector<uint32_t> expected_u32 = reference_u32(42U);
+
+    test_sequence<xxh64_prng::engine64>("engine64", expected_u64);
+    test_sequence<xxh64_prng::engine<uint64_t, 4U> >("engine64x4", expected_u64);
+    test_sequence<xxh64_prng::engine32>("engine32", expected_u32);
+    test_sequence<xxh64_prng::engine<uint32_t, 3U> >("engine32x3", expected_u32);
+    test_std();
+
+    if (failures) {
+        std::printf("\n%u check(s) have FAILED !!!\n", (unsigned)failures);
+        return EXIT_FAILURE;
+    }
+
+    std::puts("All C++ tests passed.");
+    return EXIT_SUCCESS;
+}